@@ -5,7 +5,11 @@
 #include <dsplib/ifft.h>
 #include <dsplib/hilbert.h>
 #include <dsplib/fir.h>
+#include <dsplib/iir.h>
 #include <dsplib/math.h>
+#include <dsplib/expr.h>
+#include <dsplib/split.h>
+#include <dsplib/fixed.h>
 #include <dsplib/window.h>
 #include <dsplib/types.h>
 #include <dsplib/awgn.h>
@@ -28,6 +32,9 @@
 #include <dsplib/assert.h>
 #include <dsplib/subband.h>
 #include <dsplib/buffer.h>
+#include <dsplib/workspace.h>
+#include <dsplib/cpu.h>
+#include <dsplib/parallel.h>
 
 #include <dsplib/audio/noise-gate.h>
 #include <dsplib/audio/compressor.h>
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <dsplib/defs.h>
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dsplib {
+
+//tag for the array construction without the initialization of the elements
+//use only when all the elements will be overwritten before the reading
+struct uninitialized_t
+{
+    explicit uninitialized_t() = default;
+};
+
+inline constexpr uninitialized_t uninitialized{};
+
+namespace detail {
+
+inline size_t& array_alloc_counter() noexcept {
+    DSPLIB_CACHE_T size_t counter = 0;
+    return counter;
+}
+
+}   // namespace detail
+
+//number of the array memory allocations in the current thread (to check the allocation-free processing)
+inline size_t num_array_allocs() noexcept {
+    return detail::array_alloc_counter();
+}
+
+/**
+ * @brief Aligned allocator for the array data
+ * @details The memory is aligned to `Align` bytes (DSPLIB_ARRAY_ALIGN by default) for the aligned vector loads.
+ * Construction without arguments (`std::vector<T, A>(n)`, `resize(n)`) value-initializes the elements as
+ * `std::allocator`. Construction from the `uninitialized` tag default-initializes the element, the trivially
+ * copyable types are not constructed at all, i.e. the memory is left uninitialized even for `cmplx_t` with
+ * the zero-filling default constructor (see `uninitialized_vector`).
+ * @tparam T element type
+ * @tparam Align alignment in bytes (power of 2)
+ */
+template<typename T, size_t Align = DSPLIB_ARRAY_ALIGN>
+class aligned_allocator
+{
+    static_assert((Align & (Align - 1)) == 0, "alignment must be a power of 2");
+    static_assert(Align >= alignof(T), "alignment is less than the type alignment");
+
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Align>;
+    };
+
+    aligned_allocator() noexcept = default;
+
+    template<typename U>
+    aligned_allocator(const aligned_allocator<U, Align>&) noexcept {
+    }
+
+    [[nodiscard]] T* allocate(size_t n) {
+        ++detail::array_alloc_counter();
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+
+    void deallocate(T* p, size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Align));
+    }
+
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    //default initialization, no memset
+    //trivially copyable types are implicitly created by the allocation, the constructor is skipped
+    template<typename U>
+    void construct(U* p, uninitialized_t) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        if constexpr (!(std::is_trivially_copyable_v<U> && std::is_trivially_destructible_v<U>)) {
+            ::new (static_cast<void*>(p)) U;
+        }
+    }
+
+    template<typename U>
+    bool operator==(const aligned_allocator<U, Align>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const aligned_allocator<U, Align>&) const noexcept {
+        return false;
+    }
+};
+
+template<typename T>
+using aligned_vector = std::vector<T, aligned_allocator<T>>;
+
+namespace detail {
+
+//forward iterator of `n` uninitialized tags for the vector range constructor
+class uninitialized_iterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = uninitialized_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const uninitialized_t*;
+    using reference = uninitialized_t;
+
+    explicit uninitialized_iterator(size_t i) noexcept
+      : _i{i} {
+    }
+
+    uninitialized_t operator*() const noexcept {
+        return uninitialized_t{};
+    }
+
+    uninitialized_iterator& operator++() noexcept {
+        ++_i;
+        return *this;
+    }
+
+    uninitialized_iterator operator++(int) noexcept {
+        auto r = *this;
+        ++_i;
+        return r;
+    }
+
+    bool operator==(const uninitialized_iterator& rhs) const noexcept {
+        return _i == rhs._i;
+    }
+
+    bool operator!=(const uninitialized_iterator& rhs) const noexcept {
+        return _i != rhs._i;
+    }
+
+private:
+    size_t _i;
+};
+
+}   // namespace detail
+
+//aligned vector of `n` default-initialized elements (the trivially copyable types are not filled)
+//use only when all the elements will be overwritten before the reading
+template<typename T>
+aligned_vector<T> uninitialized_vector(size_t n) {
+    return aligned_vector<T>(detail::uninitialized_iterator(0), detail::uninitialized_iterator(n));
+}
+
+}   // namespace dsplib
@@ -4,6 +4,7 @@
 #include <vector>
 #include <cassert>
 #include <cmath>
+#include <algorithm>
 
 #include <dsplib/types.h>
 #include <dsplib/slice.h>
@@ -11,11 +12,13 @@
 #include <dsplib/assert.h>
 #include <dsplib/span.h>
 #include <dsplib/traits.h>
+#include <dsplib/allocator.h>
 
 namespace dsplib {
 
 /**
  * @brief base dsplib array type
+ * @details the data is aligned to DSPLIB_ARRAY_ALIGN bytes (see `aligned_allocator`)
  * @todo add array_view as parent for array/slice
  * @todo add slice(vector<bool>)
  * @tparam T [real_t, cmplx_t, int]
@@ -32,8 +35,14 @@ public:
       : _vec(n, 0) {
     }
 
+    //array without the zero-filling, all elements must be written before reading
+    //example: `arr_cmplx r(n, uninitialized); plan->solve(x, r);`
+    explicit base_array(int n, uninitialized_t)
+      : _vec(uninitialized_vector<T>(n)) {
+    }
+
     base_array(const std::vector<T>& v)
-      : _vec(v) {
+      : _vec(v.begin(), v.end()) {
     }
 
     template<typename T2, std::enable_if_t<is_array_convertible<T2, T>(), bool> = true>
@@ -41,7 +50,13 @@ public:
       : base_array(make_span(v)) {
     }
 
-    base_array(std::vector<T>&& v) noexcept
+    //the data is copied to the aligned memory, use `aligned_vector` to move the data without a copy
+    base_array(std::vector<T>&& v)
+      : _vec(v.begin(), v.end()) {
+    }
+
+    //zero-copy construction
+    base_array(aligned_vector<T>&& v) noexcept
       : _vec(std::move(v)) {
     }
 
@@ -93,6 +108,17 @@ public:
       : base_array(make_span(ptr, size)) {
     }
 
+    //evaluation of the lazy expression (see expr.h)
+    template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+    base_array(const E& e)
+      : _vec(uninitialized_vector<T>(e.size())) {
+        static_assert(is_array_convertible<typename E::value_type, T>(), "expression type is not convertible");
+        const int n = e.size();
+        for (int i = 0; i < n; ++i) {
+            _vec[i] = e[i];
+        }
+    }
+
     //--------------------------------------------------------------------
     base_array<T>& operator=(const base_array<T>& rhs) {
         if (this == &rhs) {
@@ -102,6 +128,17 @@ public:
         return *this;
     }
 
+    //the expression may read this array, but only at the same index (element-wise)
+    template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+    base_array<T>& operator=(const E& e) {
+        if (e.size() == size()) {
+            make_span(_vec) = e;
+        } else {
+            *this = base_array<T>(e);
+        }
+        return *this;
+    }
+
     base_array<T>& operator=(base_array<T>&& rhs) noexcept {
         if (this == &rhs) {
             return *this;
@@ -132,7 +169,7 @@ public:
     //--------------------------------------------------------------------
     base_array<T> operator[](const std::vector<bool>& idxs) const {
         DSPLIB_ASSERT(idxs.size() == _vec.size(), "Array sizes must be equal");
-        std::vector<T> res;
+        aligned_vector<T> res;
         res.reserve(_vec.size());
         for (size_t i = 0; i < idxs.size(); ++i) {
             if (idxs[i]) {
@@ -143,17 +180,11 @@ public:
     }
 
     base_array<T> operator[](const std::vector<int>& idxs) const {
-        const size_t max_i = *std::max_element(idxs.begin(), idxs.end());
-        DSPLIB_ASSERT(max_i < _vec.size(), "Index must not exceed the size of the vector");
-        std::vector<T> res(idxs.size());
-        for (size_t i = 0; i < idxs.size(); ++i) {
-            res[i] = _vec[idxs[i]];
-        }
-        return res;
+        return this->_gather(idxs.data(), idxs.size());
     }
 
     base_array<T> operator[](const base_array<int>& idxs) const {
-        return (*this)[idxs.to_vec()];
+        return this->_gather(idxs.data(), idxs.size());
     }
 
     //--------------------------------------------------------------------
@@ -263,8 +294,8 @@ public:
     }
 
     //--------------------------------------------------------------------
-    using iterator = typename std::vector<T>::iterator;
-    using const_iterator = typename std::vector<T>::const_iterator;
+    using iterator = typename aligned_vector<T>::iterator;
+    using const_iterator = typename aligned_vector<T>::const_iterator;
 
     iterator begin() noexcept {
         return _vec.begin();
@@ -304,7 +335,7 @@ public:
     }
 
     base_array<T> operator-() const noexcept {
-        base_array<T> r{_vec};
+        base_array<T> r(*this);
         for (size_t i = 0; i < r.size(); ++i) {
             r[i] = -r[i];
         }
@@ -338,22 +369,22 @@ public:
 
     //--------------------------------------------------------------------
     //TODO: add lvalue + rvalue, rvalue + lvalue
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator+(const T2& rhs) const {
         return make_span(_vec) + rhs;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator-(const T2& rhs) const {
         return make_span(_vec) - rhs;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator*(const T2& rhs) const {
         return make_span(_vec) * rhs;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator/(const T2& rhs) const {
         return make_span(_vec) / rhs;
     }
@@ -375,15 +406,17 @@ public:
 
     template<typename R>
     [[nodiscard]] std::vector<R> to_vec() const noexcept {
-        if constexpr (std::is_same_v<T, R>) {
-            return _vec;
-        } else {
-            static_assert(std::is_convertible_v<T, R>, "type must be convertible");
-            return std::vector<R>(_vec.begin(), _vec.end());
-        }
+        static_assert(std::is_convertible_v<T, R>, "type must be convertible");
+        return std::vector<R>(_vec.begin(), _vec.end());
+    }
+
+    //copy of the data, use `vec()` to access the data without a copy
+    [[nodiscard]] std::vector<T> to_vec() const {
+        return std::vector<T>(_vec.begin(), _vec.end());
     }
 
-    [[nodiscard]] const std::vector<T>& to_vec() const noexcept {
+    //internal aligned storage (without a copy)
+    [[nodiscard]] const aligned_vector<T>& vec() const noexcept {
         return _vec;
     }
 
@@ -393,7 +426,9 @@ public:
             return *this;
         } else {
             static_assert(std::is_convertible_v<T, R>, "type must be convertible");
-            return base_array<R>(this->to_vec<R>());
+            base_array<R> r(size(), uninitialized);
+            std::copy(_vec.begin(), _vec.end(), r.begin());
+            return r;
         }
     }
 
@@ -408,7 +443,7 @@ public:
             }
             return out;
         } else {
-            base_array<R> out(size());
+            base_array<R> out(size(), uninitialized);
             R* pout = out.data();
             for (const T& v : _vec) {
                 *pout++ = func(v);
@@ -423,37 +458,51 @@ public:
 
 protected:
     std::ostream& _print(std::ostream& os) const;
-    std::vector<T> _vec;
+
+    base_array<T> _gather(const int* idxs, size_t n) const {
+        if (n == 0) {
+            return {};
+        }
+        const size_t max_i = *std::max_element(idxs, idxs + n);
+        DSPLIB_ASSERT(max_i < _vec.size(), "Index must not exceed the size of the vector");
+        base_array<T> res(n, uninitialized);
+        for (size_t i = 0; i < n; ++i) {
+            res[i] = _vec[idxs[i]];
+        }
+        return res;
+    }
+
+    aligned_vector<T> _vec;
 };
 
 //--------------------------------------------------------------------------------
 //left oriented scalar * array
 template<class T, class Scalar, class = enable_scalar_t<Scalar>>
 auto operator+(const Scalar& lhs, const base_array<T>& rhs) {
-    using R = ResultType<T, Scalar>;
+    using R = ResultType<base_array<T>, Scalar>;
     static_assert(std::is_convertible_v<Scalar, R>, "convertable type error");
     return rhs + lhs;
 }
 
 template<class T, class S, class = enable_scalar_t<S>>
 auto operator-(const S& lhs, const base_array<T>& rhs) {
-    using R = ResultType<T, S>;
+    using R = ResultType<base_array<T>, S>;
     static_assert(std::is_convertible_v<S, R>, "convertable type error");
     return (-rhs) + lhs;
 }
 
 template<class T, class S, class = enable_scalar_t<S>>
 auto operator*(const S& lhs, const base_array<T>& rhs) {
-    using R = ResultType<T, S>;
+    using R = ResultType<base_array<T>, S>;
     static_assert(std::is_convertible_v<S, R>, "convertable type error");
     return rhs * lhs;
 }
 
 template<class T, class S, class = enable_scalar_t<S>>
 auto operator/(const S& lhs, const base_array<T>& rhs) {
-    using R = ResultType<T, S>;
+    using R = ResultType<base_array<T>, S>;
     static_assert(std::is_convertible_v<S, R>, "convertable type error");
-    auto r = base_array<R>(rhs.size());
+    auto r = base_array<R>(rhs.size(), uninitialized);
     const auto d = R(lhs);
     for (size_t i = 0; i < r.size(); ++i) {
         r[i] = d / rhs[i];
@@ -476,4 +525,10 @@ using arr_real = base_array<real_t>;
 using arr_cmplx = base_array<cmplx_t>;
 using arr_int = base_array<int>;
 
+//explicit precision (both are supported, `arr_real` uses the default `real_t`)
+//both precisions: the real math functions, FirFilter/MultiChannelFir and the resamplers;
+//`real_t` only: complex arrays, FFT, STFT/spectrum and filter design (convert explicitly, `arr_real(x)`)
+using arr_f32 = base_array<float>;
+using arr_f64 = base_array<double>;
+
 }   // namespace dsplib
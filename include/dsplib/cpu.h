@@ -0,0 +1,28 @@
+#pragma once
+
+namespace dsplib {
+
+//SIMD level of the dispatched math kernels
+//The kernels are compiled for every level and selected at runtime by the CPU features (x86 with GCC/Clang and
+//DSPLIB_SIMD_DISPATCH=ON), other builds use only the `Baseline` kernels.
+enum class SimdLevel
+{
+    Baseline = 0,   ///< build target ISA (SSE2 for x86-64)
+    AVX2 = 1,       ///< AVX2 + FMA
+    AVX512 = 2,     ///< AVX-512 F/DQ/VL
+};
+
+//maximum level supported by the CPU and the build
+SimdLevel detected_simd_level() noexcept;
+
+//current level of the kernels (`detected_simd_level()` by default)
+SimdLevel simd_level() noexcept;
+
+//force the level of the kernels (for testing and benchmarks), the level must be supported
+//the setting is global for all threads, the results of the levels can differ by rounding (FMA, summation order)
+void set_simd_level(SimdLevel level);
+
+//restore the detected level
+void reset_simd_level() noexcept;
+
+}   // namespace dsplib
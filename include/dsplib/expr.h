@@ -0,0 +1,451 @@
+#pragma once
+
+#include <dsplib/array.h>
+#include <dsplib/math.h>
+
+#include <cmath>
+#include <type_traits>
+
+namespace dsplib {
+
+//Lazy element-wise expressions
+//`lazy(x)` wraps an array, span or slice without copying. The arithmetic operators and the element-wise functions
+//of the wrapped values build an expression tree, which is evaluated in a single loop (without intermediate arrays)
+//on assignment to base_array/mut_span/slice, on compound assignment (+=, -=, *=, /=) or by `eval()`.
+//example: pxx += abs2(lazy(spec)) / winpow;
+//the expression stores pointers to the operands, so it must not outlive them (do not keep it in `auto` variables
+//with temporary operands); the destination can be an operand only at the same index
+
+//expression leaf: contiguous or strided memory
+template<typename T>
+class expr_ref : public expr_base
+{
+public:
+    using value_type = T;
+
+    explicit expr_ref(const T* data, int size, int stride = 1) noexcept
+      : data_{data}
+      , size_{size}
+      , stride_{stride} {
+    }
+
+    [[nodiscard]] int size() const noexcept {
+        return size_;
+    }
+
+    T operator[](int i) const noexcept {
+        return data_[i * stride_];
+    }
+
+private:
+    const T* data_;
+    int size_;
+    int stride_;
+};
+
+//element-wise binary operation, one of the operands can be a scalar
+template<class Op, class L, class R>
+class expr_binary : public expr_base
+{
+public:
+    using value_type = std::remove_cv_t<decltype(Op{}(std::declval<L>()[0], std::declval<R>()[0]))>;
+
+    explicit expr_binary(const L& lhs, const R& rhs)
+      : lhs_{lhs}
+      , rhs_{rhs} {
+        DSPLIB_ASSERT(lhs_.size() < 0 || rhs_.size() < 0 || lhs_.size() == rhs_.size(), "Array lengths must be equal");
+    }
+
+    [[nodiscard]] int size() const noexcept {
+        return (lhs_.size() >= 0) ? lhs_.size() : rhs_.size();
+    }
+
+    value_type operator[](int i) const noexcept {
+        return Op{}(lhs_[i], rhs_[i]);
+    }
+
+private:
+    L lhs_;
+    R rhs_;
+};
+
+//element-wise function
+template<class Fn, class E>
+class expr_unary : public expr_base
+{
+public:
+    using value_type = std::remove_cv_t<decltype(Fn{}(std::declval<E>()[0]))>;
+
+    explicit expr_unary(const E& e)
+      : e_{e} {
+    }
+
+    [[nodiscard]] int size() const noexcept {
+        return e_.size();
+    }
+
+    value_type operator[](int i) const noexcept {
+        return Fn{}(e_[i]);
+    }
+
+private:
+    E e_;
+};
+
+//scalar operand (size -1 means "any")
+template<typename T>
+class expr_scalar : public expr_base
+{
+public:
+    using value_type = T;
+
+    explicit expr_scalar(const T& v) noexcept
+      : v_{v} {
+    }
+
+    [[nodiscard]] int size() const noexcept {
+        return -1;
+    }
+
+    T operator[](int) const noexcept {
+        return v_;
+    }
+
+private:
+    T v_;
+};
+
+//------------------------------------------------------------------------------------------------
+template<typename T>
+expr_ref<T> lazy(span_t<T> x) noexcept {
+    return expr_ref<T>(x.data(), x.size());
+}
+
+template<typename T>
+expr_ref<T> lazy(mut_span_t<T> x) noexcept {
+    return expr_ref<T>(x.data(), x.size());
+}
+
+template<typename T>
+expr_ref<T> lazy(const base_array<T>& x) noexcept {
+    return expr_ref<T>(x.data(), x.size());
+}
+
+template<typename T>
+expr_ref<T> lazy(const slice_t<T>& x) noexcept {
+    return expr_ref<T>(x.empty() ? nullptr : &*x.begin(), x.size(), x.stride());
+}
+
+template<typename T>
+expr_ref<T> lazy(const mut_slice_t<T>& x) noexcept {
+    return lazy(slice_t<T>(x));
+}
+
+//evaluate expression to a new array
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+base_array<typename E::value_type> eval(const E& e) {
+    return base_array<typename E::value_type>(e);
+}
+
+//------------------------------------------------------------------------------------------------
+namespace detail {
+
+template<typename T>
+struct is_array_operand : std::false_type
+{};
+
+template<typename T>
+struct is_array_operand<base_array<T>> : std::true_type
+{};
+
+template<typename T>
+struct is_array_operand<span_t<T>> : std::true_type
+{};
+
+template<typename T>
+struct is_array_operand<mut_span_t<T>> : std::true_type
+{};
+
+template<typename T>
+struct is_array_operand<slice_t<T>> : std::true_type
+{};
+
+template<typename T>
+struct is_array_operand<mut_slice_t<T>> : std::true_type
+{};
+
+template<typename T>
+constexpr bool is_operand_v = is_expr_v<T> || is_scalar_v<T> || is_array_operand<T>::value;
+
+//at least one operand is an expression, the arrays are wrapped
+template<typename L, typename R>
+constexpr bool is_expr_operands_v = (is_expr_v<L> || is_expr_v<R>) && is_operand_v<L> && is_operand_v<R>;
+
+template<typename T>
+auto as_expr(const T& x) {
+    if constexpr (is_expr_v<T>) {
+        return x;
+    } else if constexpr (is_scalar_v<T>) {
+        return expr_scalar<T>(x);
+    } else {
+        return lazy(x);
+    }
+}
+
+template<class Op, class L, class R>
+auto make_binary(const L& lhs, const R& rhs) {
+    using EL = decltype(as_expr(lhs));
+    using ER = decltype(as_expr(rhs));
+    return expr_binary<Op, EL, ER>(as_expr(lhs), as_expr(rhs));
+}
+
+struct op_add
+{
+    template<typename A, typename B>
+    auto operator()(const A& a, const B& b) const noexcept {
+        return a + b;
+    }
+};
+
+struct op_sub
+{
+    template<typename A, typename B>
+    auto operator()(const A& a, const B& b) const noexcept {
+        return a - b;
+    }
+};
+
+struct op_mul
+{
+    template<typename A, typename B>
+    auto operator()(const A& a, const B& b) const noexcept {
+        return a * b;
+    }
+};
+
+struct op_div
+{
+    template<typename A, typename B>
+    auto operator()(const A& a, const B& b) const noexcept {
+        return a / b;
+    }
+};
+
+struct fn_neg
+{
+    template<typename A>
+    A operator()(const A& a) const noexcept {
+        return -a;
+    }
+};
+
+//result type of the real functions: the operand precision (integers are promoted to real_t)
+template<typename A>
+using fn_real_t = std::conditional_t<std::is_floating_point_v<A>, A, real_t>;
+
+struct fn_abs
+{
+    template<typename A>
+    auto operator()(const A& a) const noexcept {
+        if constexpr (std::is_arithmetic_v<A>) {
+            return fn_real_t<A>(std::abs(a));
+        } else {
+            return dsplib::abs(a);
+        }
+    }
+};
+
+struct fn_abs2
+{
+    template<typename A>
+    auto operator()(const A& a) const noexcept {
+        if constexpr (std::is_arithmetic_v<A>) {
+            return fn_real_t<A>(a) * fn_real_t<A>(a);
+        } else {
+            return dsplib::abs2(a);
+        }
+    }
+};
+
+struct fn_conj
+{
+    template<typename A>
+    A operator()(const A& a) const noexcept {
+        return dsplib::conj(a);
+    }
+};
+
+struct fn_real
+{
+    real_t operator()(const cmplx_t& a) const noexcept {
+        return a.re;
+    }
+};
+
+struct fn_imag
+{
+    real_t operator()(const cmplx_t& a) const noexcept {
+        return a.im;
+    }
+};
+
+struct fn_exp
+{
+    template<typename A, std::enable_if_t<std::is_arithmetic_v<A>, bool> = true>
+    fn_real_t<A> operator()(const A& a) const noexcept {
+        return std::exp(fn_real_t<A>(a));
+    }
+
+    cmplx_t operator()(const cmplx_t& a) const noexcept {
+        return dsplib::exp(a);
+    }
+};
+
+struct fn_expj
+{
+    cmplx_t operator()(const real_t& a) const noexcept {
+        return {std::cos(a), std::sin(a)};
+    }
+};
+
+struct fn_sqrt
+{
+    template<typename A>
+    fn_real_t<A> operator()(const A& a) const noexcept {
+        return std::sqrt(fn_real_t<A>(a));
+    }
+};
+
+struct fn_log
+{
+    template<typename A>
+    fn_real_t<A> operator()(const A& a) const noexcept {
+        return std::log(fn_real_t<A>(a));
+    }
+};
+
+struct fn_log10
+{
+    template<typename A>
+    fn_real_t<A> operator()(const A& a) const noexcept {
+        return std::log10(fn_real_t<A>(a));
+    }
+};
+
+struct fn_sin
+{
+    template<typename A>
+    fn_real_t<A> operator()(const A& a) const noexcept {
+        return std::sin(fn_real_t<A>(a));
+    }
+};
+
+struct fn_cos
+{
+    template<typename A>
+    fn_real_t<A> operator()(const A& a) const noexcept {
+        return std::cos(fn_real_t<A>(a));
+    }
+};
+
+}   // namespace detail
+
+//------------------------------------------------------------------------------------------------
+template<class L, class R, std::enable_if_t<detail::is_expr_operands_v<L, R>, bool> = true>
+auto operator+(const L& lhs, const R& rhs) {
+    return detail::make_binary<detail::op_add>(lhs, rhs);
+}
+
+template<class L, class R, std::enable_if_t<detail::is_expr_operands_v<L, R>, bool> = true>
+auto operator-(const L& lhs, const R& rhs) {
+    return detail::make_binary<detail::op_sub>(lhs, rhs);
+}
+
+template<class L, class R, std::enable_if_t<detail::is_expr_operands_v<L, R>, bool> = true>
+auto operator*(const L& lhs, const R& rhs) {
+    return detail::make_binary<detail::op_mul>(lhs, rhs);
+}
+
+template<class L, class R, std::enable_if_t<detail::is_expr_operands_v<L, R>, bool> = true>
+auto operator/(const L& lhs, const R& rhs) {
+    return detail::make_binary<detail::op_div>(lhs, rhs);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto operator-(const E& e) {
+    return expr_unary<detail::fn_neg, E>(e);
+}
+
+//element-wise functions of the expressions
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto abs(const E& e) {
+    return expr_unary<detail::fn_abs, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto abs2(const E& e) {
+    return expr_unary<detail::fn_abs2, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto conj(const E& e) {
+    return expr_unary<detail::fn_conj, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto real(const E& e) {
+    return expr_unary<detail::fn_real, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto imag(const E& e) {
+    return expr_unary<detail::fn_imag, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto exp(const E& e) {
+    return expr_unary<detail::fn_exp, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto expj(const E& e) {
+    return expr_unary<detail::fn_expj, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto sqrt(const E& e) {
+    return expr_unary<detail::fn_sqrt, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto log(const E& e) {
+    return expr_unary<detail::fn_log, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto log10(const E& e) {
+    return expr_unary<detail::fn_log10, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto sin(const E& e) {
+    return expr_unary<detail::fn_sin, E>(e);
+}
+
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto cos(const E& e) {
+    return expr_unary<detail::fn_cos, E>(e);
+}
+
+//sum of the expression elements (without the temporary array)
+template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+auto sum(const E& e) {
+    typename E::value_type acc = 0;
+    const int n = e.size();
+    for (int i = 0; i < n; ++i) {
+        acc += e[i];
+    }
+    return acc;
+}
+
+}   // namespace dsplib
@@ -84,6 +84,7 @@ arr_cmplx fft(span_t<cmplx_t> x);
 arr_cmplx fft(span_t<cmplx_t> x, int n);
 
 //Fast Fourier Transform (real)
+//the plans are computed in `real_t` only, the array of the other precision must be converted: fft(arr_real(x))
 arr_cmplx fft(span_t<real_t> x);
 arr_cmplx fft(span_t<real_t> x, int n);
 
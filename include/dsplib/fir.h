@@ -10,23 +10,40 @@ namespace dsplib {
 
 /*!
  * \brief FIR filter class
- * \todo complex type support
+ * \details Input and coefficients can have different types (real input with complex taps and vice versa),
+ * in this case the result is complex and a specialized kernel is used (without promotion of the real operand).
+ * Complex coefficients are conjugated, as for the FirFilterC.
+ * \tparam T Input type
+ * \tparam Th Coefficients type
  */
-template<typename T>
+template<typename T, typename Th = T>
 class FirFilter
 {
 public:
-    explicit FirFilter(span_t<T> h)
+    using R = ResultType<T, Th>;
+
+    explicit FirFilter(span_t<Th> h)
       : _h(h)
       , _d(h.size() - 1) {
     }
 
-    base_array<T> process(span_t<T> x) {
-        base_array<T> r(x);
-        this->process(inplace(r));
-        return r;
+    base_array<R> process(span_t<T> x) {
+        if constexpr (std::is_same_v<T, R>) {
+            base_array<T> r(x);
+            this->process(inplace(r));
+            return r;
+        } else {
+            auto xx = concatenate(_d, x);
+            base_array<R> r(x.size());
+            FirFilter::conv(xx, _h, r);
+            const int nd = _d.size();
+            const int nx = xx.size();
+            _d.slice(0, nd) = xx.slice((nx - nd), nx);
+            return r;
+        }
     }
 
+    template<typename U = R, std::enable_if_t<std::is_same_v<U, T>, bool> = true>
     void process(inplace_span_t<T> si) {
         auto s = si.get();
         auto x = concatenate(_d, s);
@@ -38,62 +55,138 @@ public:
     }
 
     //current impulse response
-    [[nodiscard]] span_t<T> coeffs() const {
+    [[nodiscard]] span_t<Th> coeffs() const {
         return make_span(_h);
     }
 
-    mut_span_t<T> coeffs() {
+    mut_span_t<Th> coeffs() {
         return make_span(_h);
     }
 
-    base_array<T> operator()(span_t<T> x) {
+    base_array<R> operator()(span_t<T> x) {
         return this->process(x);
     }
 
 private:
-    static void conv(mut_span_t<T> x, span_t<T> h);
+    //inplace convolution (same types)
+    template<typename U = R, std::enable_if_t<std::is_same_v<U, T>, bool> = true>
+    static void conv(mut_span_t<T> x, span_t<Th> h);
 
-    base_array<T> _h;   ///< impulse response
-    base_array<T> _d;   ///< filter delay
+    //convolution with a type change (real input, complex taps), r.size() == x.size() - h.size() + 1
+    template<typename U = R, std::enable_if_t<!std::is_same_v<U, T>, bool> = true>
+    static void conv(span_t<T> x, span_t<Th> h, mut_span_t<R> r);
+
+    base_array<Th> _h;   ///< impulse response
+    base_array<T> _d;    ///< filter delay
 };
 
 using FirFilterR = FirFilter<real_t>;
 using FirFilterC = FirFilter<cmplx_t>;
+using FirFilterRC = FirFilter<real_t, cmplx_t>;   ///< real input, complex coefficients
+using FirFilterCR = FirFilter<cmplx_t, real_t>;   ///< complex input, real coefficients
 
 template<typename U>
 FirFilter(const base_array<U>&) -> FirFilter<U>;
 
-template<typename T>
+template<typename T, typename Th>
 class FftFilterImpl;
 
 /*!
  * \brief FFT-based FIR filtering using overlap-add method
- * \details Fast fir implementation for large IR length (usually > 200)
+ * \details Fast fir implementation for large IR length (usually > 200).
+ * Mixed real/complex input and coefficients are supported (see FirFilter).
+ * \tparam T Input type
+ * \tparam Th Coefficients type
  */
-template<typename T>
+template<typename T, typename Th = T>
 class FftFilter
 {
 public:
-    explicit FftFilter(span_t<T> h);
+    using R = ResultType<T, Th>;
 
-    base_array<T> process(span_t<T> x);
+    explicit FftFilter(span_t<Th> h);
 
-    base_array<T> operator()(span_t<T> x) {
+    base_array<R> process(span_t<T> x);
+
+    base_array<R> operator()(span_t<T> x) {
         return this->process(x);
     }
 
     [[nodiscard]] int block_size() const;
 
 private:
-    std::shared_ptr<FftFilterImpl<T>> d_;
+    std::shared_ptr<FftFilterImpl<T, Th>> d_;
 };
 
 using FftFilterR = FftFilter<real_t>;
 using FftFilterC = FftFilter<cmplx_t>;
+using FftFilterRC = FftFilter<real_t, cmplx_t>;   ///< real input, complex coefficients
+using FftFilterCR = FftFilter<cmplx_t, real_t>;   ///< complex input, real coefficients
 
 template<typename U>
 FftFilter(const base_array<U>&) -> FftFilter<U>;
 
+template<typename T>
+class MultiChannelFirImpl;
+
+/*!
+ * \brief Multichannel FIR filter with one impulse response for all channels
+ * \details Samples are filtered as interleaved lanes (one tap is applied to all channels at once),
+ * so the coefficients are stored only once and the inner loop is vectorized across channels.
+ */
+template<typename T>
+class MultiChannelFir
+{
+public:
+    /*!
+     * \param h Impulse response
+     * \param num_channels Number of channels
+     */
+    explicit MultiChannelFir(span_t<T> h, int num_channels);
+
+    /*!
+     * \details Use this function to save memory if multiple filters with the same IR can exist at the same time
+     * \param h Pointer to impulse response
+     * \param num_channels Number of channels
+     */
+    explicit MultiChannelFir(std::shared_ptr<const base_array<T>> h, int num_channels);
+
+    /*!
+     * \brief Interleaved processing
+     * \param x Input [x0(ch0), x0(ch1), ..., x1(ch0), x1(ch1), ...], size must be a multiple of the `num_channels`
+     * \return Output in the same layout
+     */
+    base_array<T> process(span_t<T> x);
+
+    void process(inplace_span_t<T> x);
+
+    /*!
+     * \brief Planar processing
+     * \param x Input channels [num_channels], all channels must have the same size
+     * \return Output channels [num_channels]
+     */
+    std::vector<base_array<T>> process(const std::vector<base_array<T>>& x);
+
+    base_array<T> operator()(span_t<T> x) {
+        return this->process(x);
+    }
+
+    std::vector<base_array<T>> operator()(const std::vector<base_array<T>>& x) {
+        return this->process(x);
+    }
+
+    [[nodiscard]] int num_channels() const noexcept;
+
+    //current impulse response
+    [[nodiscard]] span_t<T> coeffs() const noexcept;
+
+private:
+    std::shared_ptr<MultiChannelFirImpl<T>> d_;
+};
+
+using MultiChannelFirR = MultiChannelFir<real_t>;
+using MultiChannelFirC = MultiChannelFir<cmplx_t>;
+
 //Type of linear phase FIR filter
 FirType firtype(span_real h);
 
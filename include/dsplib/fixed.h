@@ -0,0 +1,187 @@
+#pragma once
+
+#include <dsplib/array.h>
+#include <dsplib/utils.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace dsplib {
+
+//Fixed-point processing path
+//Q15: int16, value = q / 2^15, range [-1, 1 - 2^-15]
+//Q31: int32, value = q / 2^31, range [-1, 1 - 2^-31]
+//The samples are stored in aligned vectors (not `base_array`, the array operators use the floating-point
+//promotion). All arithmetic saturates, multiplications are rounded to nearest.
+
+using q15_t = int16_t;
+using q31_t = int32_t;
+
+struct cmplx_q15_t
+{
+    q15_t re{0};
+    q15_t im{0};
+};
+
+//aligned arrays, `arr_q15(n)` is zero-filled
+using arr_q15 = aligned_vector<q15_t>;
+using arr_q31 = aligned_vector<q31_t>;
+using arr_cmplx_q15 = aligned_vector<cmplx_q15_t>;
+
+using span_q15 = span_t<q15_t>;
+using span_q31 = span_t<q31_t>;
+using span_cmplx_q15 = span_t<cmplx_q15_t>;
+using mut_span_q15 = mut_span_t<q15_t>;
+using mut_span_q31 = mut_span_t<q31_t>;
+using mut_span_cmplx_q15 = mut_span_t<cmplx_q15_t>;
+
+//-------------------------------------------------------------------------------------------------
+//scalar saturating arithmetic
+constexpr q15_t sat_q15(int32_t x) noexcept {
+    return (x > INT16_MAX) ? INT16_MAX : ((x < INT16_MIN) ? INT16_MIN : q15_t(x));
+}
+
+constexpr q31_t sat_q31(int64_t x) noexcept {
+    return (x > INT32_MAX) ? INT32_MAX : ((x < INT32_MIN) ? INT32_MIN : q31_t(x));
+}
+
+constexpr q15_t add_q15(q15_t a, q15_t b) noexcept {
+    return sat_q15(int32_t(a) + b);
+}
+
+constexpr q15_t sub_q15(q15_t a, q15_t b) noexcept {
+    return sat_q15(int32_t(a) - b);
+}
+
+constexpr q15_t mul_q15(q15_t a, q15_t b) noexcept {
+    return sat_q15((int32_t(a) * b + (1 << 14)) >> 15);
+}
+
+constexpr q31_t add_q31(q31_t a, q31_t b) noexcept {
+    return sat_q31(int64_t(a) + b);
+}
+
+constexpr q31_t sub_q31(q31_t a, q31_t b) noexcept {
+    return sat_q31(int64_t(a) - b);
+}
+
+constexpr q31_t mul_q31(q31_t a, q31_t b) noexcept {
+    return sat_q31((int64_t(a) * b + (int64_t(1) << 30)) >> 31);
+}
+
+//-------------------------------------------------------------------------------------------------
+//conversion with rounding and saturation
+arr_q15 to_q15(span_real x);
+arr_q31 to_q31(span_real x);
+arr_cmplx_q15 to_q15(span_cmplx x);
+
+arr_real from_q15(span_q15 x);
+arr_real from_q31(span_q31 x);
+arr_cmplx from_q15(span_cmplx_q15 x);
+
+//read the raw int16 samples without conversion (see `from_file`)
+arr_q15 from_file_q15(const std::string& file, endian order = endian::little, long offset = 0,
+                      long count = std::numeric_limits<long>::max());
+
+//-------------------------------------------------------------------------------------------------
+//element-wise saturating arithmetic, sizes must be equal
+arr_q15 add_q15(span_q15 x1, span_q15 x2);
+arr_q15 sub_q15(span_q15 x1, span_q15 x2);
+arr_q15 mul_q15(span_q15 x1, span_q15 x2);
+arr_q31 add_q31(span_q31 x1, span_q31 x2);
+arr_q31 sub_q31(span_q31 x1, span_q31 x2);
+arr_q31 mul_q31(span_q31 x1, span_q31 x2);
+
+//dot product with the 64-bit accumulator (without saturation)
+//Q15: the result is Q30 (`from_q15(x1) * from_q15(x2)` = result / 2^30)
+//Q31: the products are truncated to Q48 (result / 2^48)
+int64_t dot_q15(span_q15 x1, span_q15 x2);
+int64_t dot_q31(span_q31 x1, span_q31 x2);
+
+//-------------------------------------------------------------------------------------------------
+//complex FFT, n = x.size() must be a power of 2
+//every stage is scaled by 1/2 to prevent the overflow, so the result is `fft(x) / n`
+arr_cmplx_q15 fft_q15(span_cmplx_q15 x);
+
+//-------------------------------------------------------------------------------------------------
+/*!
+ * \brief Fixed-point FIR filter
+ * \details The products are accumulated in 64 bits, the output is rounded and saturated.
+ * The coefficients are not conjugated (real only).
+ * \tparam T Sample/coefficient type (q15_t or q31_t)
+ */
+template<typename T>
+class FixedFirFilter
+{
+public:
+    explicit FixedFirFilter(span_t<T> h)
+      : _h(h.begin(), h.end())
+      , _hr(_h.rbegin(), _h.rend()) {
+        DSPLIB_ASSERT(!h.empty(), "impulse response must not be empty");
+        _d.assign(h.size() - 1, 0);
+    }
+
+    aligned_vector<T> process(span_t<T> x) {
+        auto r = uninitialized_vector<T>(x.size());
+        FixedFirFilter::conv(_d, _hr, x, r, 1);
+        return r;
+    }
+
+    aligned_vector<T> operator()(span_t<T> x) {
+        return this->process(x);
+    }
+
+    [[nodiscard]] span_t<T> coeffs() const {
+        return _h;
+    }
+
+protected:
+    //y[i] = sum(z[i * decim + k] * hr[k]), z = [d | x], the delay is updated
+    static void conv(aligned_vector<T>& d, span_t<T> hr, span_t<T> x, mut_span_t<T> y, int decim);
+
+    aligned_vector<T> _h;    ///< impulse response
+    aligned_vector<T> _hr;   ///< flipped impulse response (forward order of the convolution)
+    aligned_vector<T> _d;    ///< filter delay
+};
+
+/*!
+ * \brief Fixed-point FIR decimator
+ * \details Only every `decim`-th output of the filter is computed, x.size() must be a multiple of `decim`.
+ */
+template<typename T>
+class FixedFirDecimator : private FixedFirFilter<T>
+{
+public:
+    explicit FixedFirDecimator(int decim, span_t<T> h)
+      : FixedFirFilter<T>(h)
+      , _decim{decim} {
+        DSPLIB_ASSERT(decim > 0, "decimation factor must be positive");
+    }
+
+    aligned_vector<T> process(span_t<T> x) {
+        DSPLIB_ASSERT(x.size() % _decim == 0, "input size must be a multiple of the decimation factor");
+        auto r = uninitialized_vector<T>(x.size() / _decim);
+        FixedFirDecimator::conv(this->_d, this->_hr, x, r, _decim);
+        return r;
+    }
+
+    aligned_vector<T> operator()(span_t<T> x) {
+        return this->process(x);
+    }
+
+    [[nodiscard]] int decim() const noexcept {
+        return _decim;
+    }
+
+    using FixedFirFilter<T>::coeffs;
+
+private:
+    int _decim;
+};
+
+using FirFilterQ15 = FixedFirFilter<q15_t>;
+using FirFilterQ31 = FixedFirFilter<q31_t>;
+using FirDecimatorQ15 = FixedFirDecimator<q15_t>;
+using FirDecimatorQ31 = FixedFirDecimator<q31_t>;
+
+}   // namespace dsplib
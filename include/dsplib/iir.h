@@ -0,0 +1,182 @@
+#pragma once
+
+#include <dsplib/array.h>
+
+#include <memory>
+#include <vector>
+
+namespace dsplib {
+
+/*!
+ * \brief IIR filter (transposed direct form II)
+ * \details Equivalent of the matlab `filter(b, a, x)` with saving of the filter state between calls
+ * \tparam T Input type (real_t or cmplx_t), coefficients are real
+ */
+template<typename T>
+class IirFilter
+{
+public:
+    /*!
+     * \param b Numerator coefficients
+     * \param a Denominator coefficients, a[0] must be non-zero
+     */
+    explicit IirFilter(span_real b, span_real a);
+
+    /*!
+     * \param b Numerator coefficients
+     * \param a Denominator coefficients, a[0] must be non-zero
+     * \param zi Initial conditions [max(len(b), len(a)) - 1]
+     */
+    explicit IirFilter(span_real b, span_real a, span_t<T> zi);
+
+    base_array<T> process(span_t<T> x);
+
+    void process(inplace_span_t<T> x);
+
+    base_array<T> operator()(span_t<T> x) {
+        return this->process(x);
+    }
+
+    //current filter delays (final conditions)
+    [[nodiscard]] span_t<T> state() const noexcept {
+        return make_span(z_);
+    }
+
+    //set all delays to zero
+    void reset() noexcept;
+
+    //filter order
+    [[nodiscard]] int order() const noexcept {
+        return z_.size();
+    }
+
+private:
+    arr_real b_;
+    arr_real a_;
+    base_array<T> z_;
+};
+
+using IirFilterR = IirFilter<real_t>;
+using IirFilterC = IirFilter<cmplx_t>;
+
+/*!
+ * \brief Cascade of second-order sections (biquads), transposed direct form II
+ * \details For high orders SOS form is numerically much more robust than a single IirFilter
+ * \tparam T Input type (real_t or cmplx_t), coefficients are real
+ */
+template<typename T>
+class SosFilter
+{
+public:
+    /*!
+     * \param sos Second-order sections [num_sections * 6], each row is [b0 b1 b2 a0 a1 a2] (as matlab `sos` matrix)
+     * \param g Overall gain
+     */
+    explicit SosFilter(span_real sos, real_t g = 1);
+
+    base_array<T> process(span_t<T> x);
+
+    void process(inplace_span_t<T> x);
+
+    base_array<T> operator()(span_t<T> x) {
+        return this->process(x);
+    }
+
+    [[nodiscard]] int num_sections() const noexcept {
+        return ns_;
+    }
+
+    //set all delays to zero
+    void reset() noexcept;
+
+private:
+    int ns_{0};
+    real_t g_{1};
+    arr_real c_;         ///< normalized coefficients [b0 b1 b2 a1 a2] for each section
+    base_array<T> z_;    ///< delays [z1 z2] for each section
+};
+
+using SosFilterR = SosFilter<real_t>;
+using SosFilterC = SosFilter<cmplx_t>;
+
+template<typename T>
+class MultiChannelSosFilterImpl;
+
+/*!
+ * \brief Multichannel SOS filter with one set of sections for all channels
+ * \details The channels are processed as interleaved lanes, each section is vectorized across channels.
+ * \tparam T Input type (real_t or cmplx_t), coefficients are real
+ */
+template<typename T>
+class MultiChannelSosFilter
+{
+public:
+    /*!
+     * \param sos Second-order sections [num_sections * 6], each row is [b0 b1 b2 a0 a1 a2]
+     * \param num_channels Number of channels
+     * \param g Overall gain
+     */
+    explicit MultiChannelSosFilter(span_real sos, int num_channels, real_t g = 1);
+
+    /*!
+     * \brief Interleaved processing
+     * \param x Input [x0(ch0), x0(ch1), ..., x1(ch0), x1(ch1), ...], size must be a multiple of the `num_channels`
+     * \return Output in the same layout
+     */
+    base_array<T> process(span_t<T> x);
+
+    void process(inplace_span_t<T> x);
+
+    /*!
+     * \brief Planar processing
+     * \param x Input channels [num_channels], all channels must have the same size
+     * \return Output channels [num_channels]
+     */
+    std::vector<base_array<T>> process(const std::vector<base_array<T>>& x);
+
+    base_array<T> operator()(span_t<T> x) {
+        return this->process(x);
+    }
+
+    std::vector<base_array<T>> operator()(const std::vector<base_array<T>>& x) {
+        return this->process(x);
+    }
+
+    [[nodiscard]] int num_channels() const noexcept;
+
+    void reset() noexcept;
+
+private:
+    std::shared_ptr<MultiChannelSosFilterImpl<T>> d_;
+};
+
+using MultiChannelSosFilterR = MultiChannelSosFilter<real_t>;
+using MultiChannelSosFilterC = MultiChannelSosFilter<cmplx_t>;
+
+//1-D digital filter (matlab `y = filter(b, a, x)`)
+arr_real filter(span_real b, span_real a, span_real x);
+arr_cmplx filter(span_real b, span_real a, span_cmplx x);
+
+//filter with initial conditions (matlab `[y, zf] = filter(b, a, x, zi)`)
+//zi - initial conditions [max(len(b), len(a)) - 1]
+//result: [output, final conditions]
+std::pair<arr_real, arr_real> filter(span_real b, span_real a, span_real x, span_real zi);
+std::pair<arr_cmplx, arr_cmplx> filter(span_real b, span_real a, span_cmplx x, span_cmplx zi);
+
+//filter by second-order sections (matlab `sosfilt(sos, x)`)
+//sos - [num_sections * 6], each row is [b0 b1 b2 a0 a1 a2]
+arr_real sosfilt(span_real sos, span_real x);
+arr_cmplx sosfilt(span_real sos, span_cmplx x);
+
+//zero-phase digital filtering (matlab `filtfilt(b, a, x)`)
+//the edges are extended by odd reflection (3 * order samples) and the initial conditions are matched to them,
+//long FIR filters (a = 1) are processed by FFT convolution
+//x.size() must be greater than 3 * (max(len(b), len(a)) - 1)
+arr_real filtfilt(span_real b, span_real a, span_real x);
+arr_cmplx filtfilt(span_real b, span_real a, span_cmplx x);
+
+//inplace version, no signal-size temporary arrays are allocated
+void filtfilt(span_real b, span_real a, inplace_real x);
+void filtfilt(span_real b, span_real a, inplace_cmplx x);
+
+}   // namespace dsplib
@@ -100,7 +100,7 @@ public:
         }
 
         const int n = in.size();
-        base_array<T> out(n);
+        base_array<T> out(n, uninitialized);
         for (int i = 0; i < n; i++) {
             out[i] = process(in[i]);
         }
@@ -9,8 +9,29 @@ namespace dsplib {
 
 //TODO: mark noexcept
 
+//the real array functions are overloaded for both precisions (arr_f32/arr_f64), the result keeps the precision
+//of the input; `arr_real` is one of them (see DSPLIB_USE_FLOAT32)
+
+//accuracy of the array overloads of exp, expj, log, log2, log10, sin, cos, tanh, angle, pow2db/db2pow/mag2db/db2mag
+//and the fused magphase/abs2db (vectorized polynomial kernels, the scalar overloads use the std functions)
+//Precise: error <= 2 ULP for exp/log/log2/sin/cos/expj/tanh/angle, <= 4 ULP for log10/pow2db/mag2db;
+//  abs2db has the error of pow2db(abs2(x));
+//  db2pow/db2mag have additional relative error |x| * ln(10)/10 * eps of the argument scaling;
+//  sin/cos/expj use the std functions for |x| > 2^19
+//Fast: relative error < 1e-8 (absolute for sin/cos), several times faster
+//the setting is global for all threads
+enum class MathAccuracy
+{
+    Precise,
+    Fast
+};
+
+void set_math_accuracy(MathAccuracy accuracy) noexcept;
+MathAccuracy math_accuracy() noexcept;
+
 //exponential
-arr_real exp(span_real arr);
+arr_f32 exp(span_f32 arr);
+arr_f64 exp(span_f64 arr);
 real_t exp(real_t v);
 arr_cmplx exp(span_cmplx arr);
 cmplx_t exp(cmplx_t v);
@@ -21,11 +42,13 @@ arr_cmplx expj(span_real w);
 cmplx_t expj(real_t w);
 
 //hyperbolic tangent
-arr_real tanh(span_real x);
+arr_f32 tanh(span_f32 x);
+arr_f64 tanh(span_f64 x);
 arr_cmplx tanh(span_cmplx x);
 
 //max element
-real_t max(span_real arr);
+float max(span_f32 arr);
+double max(span_f64 arr);
 cmplx_t max(span_cmplx arr);
 
 template<typename T1, typename T2>
@@ -34,7 +57,8 @@ auto max(const T1& v1, const T2& v2) -> decltype(v1 + v2) {
 }
 
 //min element
-real_t min(span_real arr);
+float min(span_f32 arr);
+double min(span_f64 arr);
 cmplx_t min(span_cmplx arr);
 
 template<typename T1, typename T2>
@@ -43,38 +67,52 @@ auto min(const T1& v1, const T2& v2) -> decltype(v1 + v2) {
 }
 
 // range of values (maximum - minimum)
-real_t peak2peak(span_real arr);
+float peak2peak(span_f32 arr);
+double peak2peak(span_f64 arr);
 cmplx_t peak2peak(span_cmplx arr);
 
 //max element index
-int argmax(span_real arr);
+int argmax(span_f32 arr);
+int argmax(span_f64 arr);
 int argmax(span_cmplx arr);
 
 //min element index
-int argmin(span_real arr);
+int argmin(span_f32 arr);
+int argmin(span_f64 arr);
 int argmin(span_cmplx arr);
 
 //absolute value and complex magnitude
-arr_real abs(span_real arr) noexcept;
+arr_f32 abs(span_f32 arr) noexcept;
+arr_f64 abs(span_f64 arr) noexcept;
 real_t abs(real_t v) noexcept;
 arr_real abs(span_cmplx arr) noexcept;
 real_t abs(cmplx_t v) noexcept;
-void abs(inplace_real arr) noexcept;
+void abs(inplace_f32 arr) noexcept;
+void abs(inplace_f64 arr) noexcept;
+void abs(span_cmplx x, mut_span_real r);
 
 //phase angle in the interval [-pi, pi] for each element of a complex array z
+//angle(z) = atan2(z.im, z.re)
 arr_real angle(span_cmplx arr);
 real_t angle(cmplx_t v);
+void angle(span_cmplx x, mut_span_real r);
+
+//magnitude and phase angle in one pass: mag = abs(x), phase = angle(x)
+void magphase(span_cmplx x, mut_span_real mag, mut_span_real phase);
 
 //round
 real_t round(const real_t& x) noexcept;
 cmplx_t round(const cmplx_t& x) noexcept;
-arr_real round(span_real arr) noexcept;
+arr_f32 round(span_f32 arr) noexcept;
+arr_f64 round(span_f64 arr) noexcept;
 arr_cmplx round(span_cmplx arr) noexcept;
-void round(inplace_real arr) noexcept;
+void round(inplace_f32 arr) noexcept;
+void round(inplace_f64 arr) noexcept;
 void round(inplace_cmplx arr) noexcept;
 
 //array sum
-real_t sum(span_real arr);
+float sum(span_f32 arr);
+double sum(span_f64 arr);
 cmplx_t sum(span_cmplx arr);
 int sum(const std::vector<bool>& arr);
 
@@ -84,19 +122,23 @@ arr_real cumsum(span_real x, Direction dir = Direction::Forward);
 arr_cmplx cumsum(span_cmplx x, Direction dir = Direction::Forward);
 
 //array dot
-real_t dot(span_real x1, span_real x2);
+float dot(span_f32 x1, span_f32 x2);
+double dot(span_f64 x1, span_f64 x2);
 cmplx_t dot(span_cmplx x1, span_cmplx x2);
 
 //array mean
-real_t mean(span_real arr);
+float mean(span_f32 arr);
+double mean(span_f64 arr);
 cmplx_t mean(span_cmplx arr);
 
 //standard deviation
-real_t stddev(span_real arr);
+float stddev(span_f32 arr);
+double stddev(span_f64 arr);
 real_t stddev(span_cmplx arr);
 
 //median
-real_t median(span_real arr);
+float median(span_f32 arr);
+double median(span_f64 arr);
 
 //linear or rank correlation
 //TODO: add p-value result
@@ -197,25 +239,33 @@ arr_cmplx power(const arr_cmplx& x, int n);
 //square root (only positive values)
 //TODO: add complex result for negative or complex input
 real_t sqrt(real_t x) noexcept;
-arr_real sqrt(span_real arr) noexcept;
-void sqrt(inplace_real arr) noexcept;
+arr_f32 sqrt(span_f32 arr) noexcept;
+arr_f64 sqrt(span_f64 arr) noexcept;
+void sqrt(inplace_f32 arr) noexcept;
+void sqrt(inplace_f64 arr) noexcept;
 
 //array log
-arr_real log(span_real arr);
-arr_real log2(span_real arr);
-arr_real log10(span_real arr);
+arr_f32 log(span_f32 arr);
+arr_f64 log(span_f64 arr);
+arr_f32 log2(span_f32 arr);
+arr_f64 log2(span_f64 arr);
+arr_f32 log10(span_f32 arr);
+arr_f64 log10(span_f64 arr);
 
 real_t log(const real_t& x);
 real_t log2(const real_t& x);
 real_t log10(const real_t& x);
 
 //array rms
-real_t rms(span_real arr);
+float rms(span_f32 arr);
+double rms(span_f64 arr);
 real_t rms(span_cmplx arr);
 
 //trigonometric functions
-arr_real sin(span_real arr);
-arr_real cos(span_real arr);
+arr_f32 sin(span_f32 arr);
+arr_f64 sin(span_f64 arr);
+arr_f32 cos(span_f32 arr);
+arr_f64 cos(span_f64 arr);
 
 //decrease sample rate by integer factor
 arr_real downsample(span_real arr, int n, int phase = 0);
@@ -227,6 +277,7 @@ arr_cmplx upsample(span_cmplx arr, int n, int phase = 0);
 
 //abs(x)^2
 arr_real abs2(const arr_cmplx& x) noexcept;
+void abs2(span_cmplx x, mut_span_real r);
 
 constexpr real_t abs2(const cmplx_t& x) noexcept {
     return x.abs2();
@@ -241,26 +292,31 @@ constexpr real_t abs2(const real_t& x) noexcept {
 }
 
 //from degrees to radians
-arr_real deg2rad(span_real x);
+arr_f32 deg2rad(span_f32 x);
+arr_f64 deg2rad(span_f64 x);
 real_t deg2rad(const real_t& x);
 
 //from radians to degrees
-arr_real rad2deg(span_real x);
+arr_f32 rad2deg(span_f32 x);
+arr_f64 rad2deg(span_f64 x);
 real_t rad2deg(const real_t& x);
 
 //vector norms
 //p=1, sum(abs(x))
 //p=2, euclidean norm of vector, sum(abs(x).^2)^(1/2)
 //p>0, sum(abs(x).^p)^(1/p)
-real_t norm(span_real x, int p = 2);
+float norm(span_f32 x, int p = 2);
+double norm(span_f64 x, int p = 2);
 real_t norm(span_cmplx x, int p = 2);
 
 //Mean squared error
-real_t mse(span_real x, span_real y);
+float mse(span_f32 x, span_f32 y);
+double mse(span_f64 x, span_f64 y);
 real_t mse(span_cmplx x, span_cmplx y);
 
 //Normalized mean squared error
-real_t nmse(span_real x, span_real y);
+float nmse(span_f32 x, span_f32 y);
+double nmse(span_f64 x, span_f64 y);
 real_t nmse(span_cmplx x, span_cmplx y);
 
 //signum function
@@ -278,19 +334,32 @@ inline cmplx_t sign(const cmplx_t& x) noexcept {
 //----------------------------------------------------------------------------------------
 //convert power <-> decibels: db = 10 * log10(pow)
 real_t pow2db(real_t v) noexcept;
-arr_real pow2db(span_real arr) noexcept;
+arr_f32 pow2db(span_f32 arr) noexcept;
+arr_f64 pow2db(span_f64 arr) noexcept;
 real_t db2pow(real_t v) noexcept;
-arr_real db2pow(span_real arr) noexcept;
-void pow2db(inplace_real arr) noexcept;
-void db2pow(inplace_real arr) noexcept;
+arr_f32 db2pow(span_f32 arr) noexcept;
+arr_f64 db2pow(span_f64 arr) noexcept;
+void pow2db(inplace_f32 arr) noexcept;
+void pow2db(inplace_f64 arr) noexcept;
+void db2pow(inplace_f32 arr) noexcept;
+void db2pow(inplace_f64 arr) noexcept;
 
 //convert magnitude <-> decibels: db = 20 * log10(mag)
 real_t mag2db(real_t v) noexcept;
-arr_real mag2db(span_real arr) noexcept;
+arr_f32 mag2db(span_f32 arr) noexcept;
+arr_f64 mag2db(span_f64 arr) noexcept;
 real_t db2mag(real_t v) noexcept;
-arr_real db2mag(span_real arr) noexcept;
-void mag2db(inplace_real arr) noexcept;
-void db2mag(inplace_real arr) noexcept;
+arr_f32 db2mag(span_f32 arr) noexcept;
+arr_f64 db2mag(span_f64 arr) noexcept;
+void mag2db(inplace_f32 arr) noexcept;
+void mag2db(inplace_f64 arr) noexcept;
+void db2mag(inplace_f32 arr) noexcept;
+void db2mag(inplace_f64 arr) noexcept;
+
+//power of complex values in decibels in one pass: abs2db(x) = pow2db(abs2(x))
+//example: spectrum in dB without the temporary arrays, abs2db(fft(x), r)
+arr_real abs2db(span_cmplx x) noexcept;
+void abs2db(span_cmplx x, mut_span_real r);
 
 //----------------------------------------------------------------------------------------
 //check that the number is prime
@@ -315,11 +384,13 @@ arr_int primes(uint32_t n);
 //missing data
 
 //determine if any array element is NaN
-bool anynan(span_real x);
+bool anynan(span_f32 x);
+bool anynan(span_f64 x);
 bool anynan(span_cmplx x);
 
 //determine if any array element is Inf or -Inf
-bool anyinf(span_real x);
+bool anyinf(span_f32 x);
+bool anyinf(span_f64 x);
 bool anyinf(span_cmplx x);
 
 }   // namespace dsplib
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace dsplib {
+
+//parallel execution of the functions for the large arrays: sum, dot, rms, norm, mse/nmse, max/min, argmax/argmin
+//and the element-wise functions (abs, abs2, angle, exp, log, sin, cos, tanh, pow2db, abs2db, ...)
+//The arrays with `size >= parallel_threshold()` are split into the fixed blocks, the blocks are processed by the
+//global thread pool (or by the calling thread for `num_threads() == 1`). The partial results of the blocks are
+//combined pairwise in the fixed order, so the result is bit-identical for any number of threads and scheduling.
+//Disabled by default (1 thread). DSPLIB_PARALLEL=OFF builds are always single-threaded.
+
+//number of threads including the calling thread, 0 = number of CPU cores
+//the setting is global, the calls from several user threads are allowed (the busy pool is not shared, such a call
+//is executed in the calling thread)
+void set_num_threads(int n);
+int num_threads() noexcept;
+
+//minimum array size for the parallel execution (1M elements by default)
+void set_parallel_threshold(int n);
+int parallel_threshold() noexcept;
+
+}   // namespace dsplib
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <dsplib/utils.h>
 #include <dsplib/array.h>
@@ -8,24 +10,51 @@
 
 namespace dsplib {
 
-//TODO: complex type implementation
-
 //multirate FIR filter design (similar to implementation in MATLAB)
 arr_real design_multirate_fir(int interp, int decim, int hlen = 12, real_t astop = 90);
 
+//cached `design_multirate_fir`, the immutable result is shared between all calls with the same parameters
+//(use it for many resamplers/channelizers with the same filter, the polyphase tables are shared too)
+std::shared_ptr<const arr_real> shared_multirate_fir(int interp, int decim, int hlen = 12, real_t astop = 90);
+
+//half-band lowpass filter design (cutoff 0.5), the result length is `4 * hlen - 1`
+//every second tap (except the center) is zero, the center tap is 0.5
+arr_real design_halfband_fir(int hlen = 12, real_t astop = 90);
+
+//packed polyphase branches (internal)
+struct PolyphaseTable;
+
 //------------------------------------------------------------------------------
 //base resample class
-class IResampler
+//T - sample type (float, double or cmplx_t), the filter coefficients are always real_t
+template<typename T>
+class BaseResampler
 {
 public:
-    virtual ~IResampler() = default;
-
-    virtual arr_real process(span_real sig) = 0;
+    virtual ~BaseResampler() = default;
+
+    virtual base_array<T> process(span_t<T> sig) = 0;
+
+    /**
+     * @brief Processing into the caller memory
+     * @param in [in] input frame
+     * @param out [out] output frame, out.size() must be equal output_size(in.size())
+     */
+    virtual void process(span_t<T> in, mut_span_t<T> out) {
+        //default non optimal implementation with temp array
+        out = this->process(in);
+    }
 
     [[nodiscard]] virtual int delay() const noexcept {
         return 0;
     }
 
+    //number of output samples that the next `process` call produces for the input of `size` samples
+    //(the streaming resamplers accumulate the input remainder between calls)
+    [[nodiscard]] virtual int output_size(int size) const noexcept {
+        return size / this->decim_rate() * this->interp_rate();
+    }
+
     [[nodiscard]] virtual int decim_rate() const noexcept {
         return 1;
     }
@@ -35,11 +64,11 @@ public:
     }
 
     [[nodiscard]] int next_size(int size) const noexcept {
-        return IResampler::next_size(size, this->interp_rate(), this->decim_rate());
+        return BaseResampler::next_size(size, this->interp_rate(), this->decim_rate());
     }
 
     [[nodiscard]] int prev_size(int size) const noexcept {
-        return IResampler::prev_size(size, this->interp_rate(), this->decim_rate());
+        return BaseResampler::prev_size(size, this->interp_rate(), this->decim_rate());
     }
 
     //polyphase decomposition of multirate filter
@@ -53,90 +82,133 @@ public:
     static std::pair<int, int> simplify(int p, int q);
 };
 
+using IResampler = BaseResampler<real_t>;
+using IResamplerC = BaseResampler<cmplx_t>;
+
 //------------------------------------------------------------------------------
 //polyphase FIR decimation
-class FIRDecimator : public IResampler
+template<typename T>
+class BaseFIRDecimator : public BaseResampler<T>
 {
 public:
-    explicit FIRDecimator(int decim);
+    explicit BaseFIRDecimator(int decim);
 
     //decim - decimation factor
     //h - custom multirate fir filter
-    explicit FIRDecimator(int decim, span_real h);
+    explicit BaseFIRDecimator(int decim, span_real h);
 
-    //in.size() must be a multiple of the decim
-    arr_real process(span_real in) final;
+    //h - shared multirate fir filter, the polyphase table is cached and shared between instances
+    explicit BaseFIRDecimator(int decim, std::shared_ptr<const arr_real> h);
 
+    //any input length, the remainder of the input (less than decim) is processed in the next call
+    base_array<T> process(span_t<T> in) final;
+
+    //out.size() must be output_size(in.size()), no memory is allocated
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    [[nodiscard]] int output_size(int size) const noexcept final;
     [[nodiscard]] int delay() const noexcept final;
     [[nodiscard]] int decim_rate() const noexcept final;
 
 private:
-    std::shared_ptr<IResampler> d_;
+    std::shared_ptr<BaseResampler<T>> d_;
 };
 
+using FIRDecimator = BaseFIRDecimator<real_t>;
+using FIRDecimatorC = BaseFIRDecimator<cmplx_t>;
+
 //------------------------------------------------------------------------------
 //polyphase FIR interpolation
-class FIRInterpolator : public IResampler
+template<typename T>
+class BaseFIRInterpolator : public BaseResampler<T>
 {
 public:
-    explicit FIRInterpolator(int interp);
+    explicit BaseFIRInterpolator(int interp);
 
     //interp - interpolation factor
     //h - custom multirate fir filter
-    explicit FIRInterpolator(int interp, span_real h);
+    explicit BaseFIRInterpolator(int interp, span_real h);
+
+    //h - shared multirate fir filter, the polyphase table is cached and shared between instances
+    explicit BaseFIRInterpolator(int interp, std::shared_ptr<const arr_real> h);
+
+    base_array<T> process(span_t<T> in) final;
 
-    arr_real process(span_real in) final;
+    //out.size() must be in.size() * interp, no memory is allocated
+    void process(span_t<T> in, mut_span_t<T> out) final;
 
     [[nodiscard]] int delay() const noexcept final;
     [[nodiscard]] int interp_rate() const noexcept final;
 
 private:
-    std::vector<arr_real> h_;
-    arr_real d_;
+    explicit BaseFIRInterpolator(int interp, std::shared_ptr<const PolyphaseTable> table);
+
+    std::shared_ptr<const PolyphaseTable> tab_;   ///< packed polyphase branches [interp * sublen]
+    base_array<T> d_;                             ///< delay buffer [history | head of input]
     int interp_;
     int sublen_;
 };
 
+using FIRInterpolator = BaseFIRInterpolator<real_t>;
+using FIRInterpolatorC = BaseFIRInterpolator<cmplx_t>;
+
 //------------------------------------------------------------------------------
 //polyphase FIR sample rate conversion
-class FIRRateConverter : public IResampler
+template<typename T>
+class BaseFIRRateConverter : public BaseResampler<T>
 {
 public:
-    explicit FIRRateConverter(int interp, int decim);
+    explicit BaseFIRRateConverter(int interp, int decim);
 
     //interp - interpolation factor
     //decim - decimation factor
     //h - custom multirate fir filter
-    explicit FIRRateConverter(int interp, int decim, span_real h);
+    explicit BaseFIRRateConverter(int interp, int decim, span_real h);
 
-    //in.size() must be a multiple of the decim
-    arr_real process(span_real in) final;
+    //h - shared multirate fir filter, the polyphase table is cached and shared between instances
+    explicit BaseFIRRateConverter(int interp, int decim, std::shared_ptr<const arr_real> h);
+
+    //any input length, the remainder of the input (less than decim) is processed in the next call
+    base_array<T> process(span_t<T> in) final;
+
+    //out.size() must be output_size(in.size()), no memory is allocated
+    void process(span_t<T> in, mut_span_t<T> out) final;
 
+    [[nodiscard]] int output_size(int size) const noexcept final;
     [[nodiscard]] int delay() const noexcept final;
     [[nodiscard]] int interp_rate() const noexcept final;
     [[nodiscard]] int decim_rate() const noexcept final;
 
 private:
-    std::vector<arr_real> h_;
-    arr_real d_;
+    explicit BaseFIRRateConverter(int interp, int decim, std::shared_ptr<const PolyphaseTable> table);
+
+    std::shared_ptr<const PolyphaseTable> tab_;   ///< packed polyphase branches in the processing order
+    base_array<T> d_;                             ///< delay buffer [history | head of input]
+    base_array<T> acc_;                           ///< input remainder [decim]
+    int nacc_{0};
     int interp_;
     int decim_;
     int sublen_;
-    std::vector<uint16_t> xidxs_;
 };
 
+using FIRRateConverter = BaseFIRRateConverter<real_t>;
+using FIRRateConverterC = BaseFIRRateConverter<cmplx_t>;
+
 //------------------------------------------------------------------------------
 //Wrapper over FIRRateConverter, FIRInterpolator and FIRDecimator
 //with calculation of optimal L/M coefficients for sample rate conversion
 //TODO: filter transition band setting
-class FIRResampler : public IResampler
+template<typename T>
+class BaseFIRResampler : public BaseResampler<T>
 {
 public:
     //out_fs - output sample rate (Hz)
     //in_fs - input sample rate (Hz)
-    explicit FIRResampler(int out_fs, int in_fs);
+    explicit BaseFIRResampler(int out_fs, int in_fs);
+
+    explicit BaseFIRResampler(int out_fs, int in_fs, span_real h);
 
-    explicit FIRResampler(int out_fs, int in_fs, span_real h);
+    explicit BaseFIRResampler(int out_fs, int in_fs, std::shared_ptr<const arr_real> h);
 
     enum class Mode
     {
@@ -146,26 +218,379 @@ public:
         Resampler
     };
 
-    arr_real process(span_real sig) final;
+    base_array<T> process(span_t<T> sig) final;
 
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    [[nodiscard]] int output_size(int size) const noexcept final;
     [[nodiscard]] int delay() const noexcept final;
     [[nodiscard]] int interp_rate() const noexcept final;
     [[nodiscard]] int decim_rate() const noexcept final;
 
 private:
     Mode mode_{Mode::Bypass};
-    std::shared_ptr<IResampler> rsmp_;
+    std::shared_ptr<BaseResampler<T>> rsmp_;
 };
 
+using FIRResampler = BaseFIRResampler<real_t>;
+using FIRResamplerC = BaseFIRResampler<cmplx_t>;
+
+//------------------------------------------------------------------------------
+template<typename T>
+class MultiChannelResamplerImpl;
+
+//Multichannel polyphase FIR resampler (same filter for all channels)
+//The polyphase table is stored once and the channels are processed as interleaved lanes,
+//so one tap is applied to all channels at once. The result is equal to FIRResampler for each channel.
+template<typename T>
+class BaseMultiChannelResampler
+{
+public:
+    //out_fs - output sample rate (Hz)
+    //in_fs - input sample rate (Hz)
+    explicit BaseMultiChannelResampler(int out_fs, int in_fs, int num_channels);
+
+    //h - custom multirate fir filter
+    explicit BaseMultiChannelResampler(int out_fs, int in_fs, span_real h, int num_channels);
+
+    //h - shared multirate fir filter, the polyphase table is cached and shared between instances
+    explicit BaseMultiChannelResampler(int out_fs, int in_fs, std::shared_ptr<const arr_real> h, int num_channels);
+
+    /*!
+     * \brief Interleaved processing
+     * \details Any number of frames, the remainder (less than decim frames) is processed in the next call
+     * \param x Input [x0(ch0), x0(ch1), ..., x1(ch0), x1(ch1), ...], size must be a multiple of the `num_channels`
+     * \return Output in the same layout [output_size(x.size())]
+     */
+    base_array<T> process(span_t<T> x);
+
+    //out.size() must be output_size(in.size()), no memory is allocated
+    void process(span_t<T> in, mut_span_t<T> out);
+
+    /*!
+     * \brief Planar processing
+     * \param x Input channels [num_channels], all channels must have the same size
+     * \return Output channels [num_channels]
+     */
+    std::vector<base_array<T>> process(const std::vector<base_array<T>>& x);
+
+    base_array<T> operator()(span_t<T> x) {
+        return this->process(x);
+    }
+
+    std::vector<base_array<T>> operator()(const std::vector<base_array<T>>& x) {
+        return this->process(x);
+    }
+
+    //number of output samples (all channels) for the next interleaved input of `size` samples
+    [[nodiscard]] int output_size(int size) const noexcept;
+
+    [[nodiscard]] int num_channels() const noexcept;
+    [[nodiscard]] int delay() const noexcept;
+    [[nodiscard]] int interp_rate() const noexcept;
+    [[nodiscard]] int decim_rate() const noexcept;
+
+private:
+    std::shared_ptr<MultiChannelResamplerImpl<T>> d_;
+};
+
+using MultiChannelResampler = BaseMultiChannelResampler<real_t>;
+using MultiChannelResamplerC = BaseMultiChannelResampler<cmplx_t>;
+
+//------------------------------------------------------------------------------
+//half-band decimation by 2
+//only the non-zero taps are processed and the symmetry is folded: hlen + 1 MACs per output
+//(instead of 4 * hlen for the FIRDecimator with the same filter)
+template<typename T>
+class BaseHalfbandDecimator : public BaseResampler<T>
+{
+public:
+    explicit BaseHalfbandDecimator(int hlen = 12, real_t astop = 90);
+
+    //h - custom half-band filter [4 * hlen - 1] (see `design_halfband_fir`)
+    explicit BaseHalfbandDecimator(span_real h);
+
+    //any input length, the odd remainder is processed in the next call
+    base_array<T> process(span_t<T> in) final;
+
+    //out.size() must be output_size(in.size())
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    [[nodiscard]] int output_size(int size) const noexcept final;
+    [[nodiscard]] int delay() const noexcept final;
+    [[nodiscard]] int decim_rate() const noexcept final;
+
+private:
+    int hlen_;
+    real_t c_;            ///< center tap
+    arr_real g_;          ///< non-zero side taps [hlen]
+    base_array<T> d_;     ///< delay buffer [history | head of input]
+    base_array<T> acc_;   ///< input remainder [2]
+    int nacc_{0};
+};
+
+using HalfbandDecimator = BaseHalfbandDecimator<real_t>;
+using HalfbandDecimatorC = BaseHalfbandDecimator<cmplx_t>;
+
+//half-band interpolation by 2
+//the odd outputs are the delayed input, the even outputs use `hlen` MACs (folded symmetry)
+template<typename T>
+class BaseHalfbandInterpolator : public BaseResampler<T>
+{
+public:
+    explicit BaseHalfbandInterpolator(int hlen = 12, real_t astop = 90);
+
+    //h - custom half-band filter [4 * hlen - 1] (see `design_halfband_fir`)
+    explicit BaseHalfbandInterpolator(span_real h);
+
+    base_array<T> process(span_t<T> in) final;
+
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    [[nodiscard]] int delay() const noexcept final;
+    [[nodiscard]] int interp_rate() const noexcept final;
+
+private:
+    int hlen_;
+    real_t c_;          ///< center tap
+    arr_real b_;        ///< folded taps of the even branch [hlen]
+    base_array<T> d_;   ///< delay buffer [history | head of input]
+};
+
+using HalfbandInterpolator = BaseHalfbandInterpolator<real_t>;
+using HalfbandInterpolatorC = BaseHalfbandInterpolator<cmplx_t>;
+
+//------------------------------------------------------------------------------
+//CIC (cascaded integrator-comb) decimation, multiplier-free first stage for the large ratios
+//The integrators and combs are 64-bit fixed-point registers with wraparound (Hogenauer), the input is quantized
+//with `frac_bits()` fractional bits, so the input must be in the range [-1, 1].
+//The result is normalized by the DC gain (decim * diff_delay)^order.
+//order * log2(decim * diff_delay) must be <= 54 (register growth)
+template<typename T>
+class BaseCICDecimator : public BaseResampler<T>
+{
+public:
+    explicit BaseCICDecimator(int decim, int order = 4, int diff_delay = 1);
+
+    //in.size() must be a multiple of the decim
+    base_array<T> process(span_t<T> in) final;
+
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    //group delay (output samples, rounded)
+    [[nodiscard]] int delay() const noexcept final;
+    [[nodiscard]] int decim_rate() const noexcept final;
+
+    //fixed-point precision of the input
+    [[nodiscard]] int frac_bits() const noexcept {
+        return qbits_;
+    }
+
+private:
+    int decim_;
+    int order_;
+    int ddelay_;
+    int qbits_;
+    real_t qscale_;                 ///< input scale, 2^qbits
+    real_t oscale_;                 ///< output scale, 1 / (2^qbits * gain)
+    int cpos_{0};                   ///< position in the comb delay lines
+    std::vector<uint64_t> integ_;   ///< integrators [order * lanes]
+    std::vector<uint64_t> comb_;    ///< comb delay lines [order * diff_delay * lanes]
+};
+
+using CICDecimator = BaseCICDecimator<real_t>;
+using CICDecimatorC = BaseCICDecimator<cmplx_t>;
+
+//CIC interpolation (see BaseCICDecimator)
+//The result is normalized by the DC gain (interp * diff_delay)^order / interp.
+template<typename T>
+class BaseCICInterpolator : public BaseResampler<T>
+{
+public:
+    explicit BaseCICInterpolator(int interp, int order = 4, int diff_delay = 1);
+
+    base_array<T> process(span_t<T> in) final;
+
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    //group delay (output samples, rounded)
+    [[nodiscard]] int delay() const noexcept final;
+    [[nodiscard]] int interp_rate() const noexcept final;
+
+    //fixed-point precision of the input
+    [[nodiscard]] int frac_bits() const noexcept {
+        return qbits_;
+    }
+
+private:
+    int interp_;
+    int order_;
+    int ddelay_;
+    int qbits_;
+    real_t qscale_;
+    real_t oscale_;
+    int cpos_{0};
+    std::vector<uint64_t> integ_;
+    std::vector<uint64_t> comb_;
+};
+
+using CICInterpolator = BaseCICInterpolator<real_t>;
+using CICInterpolatorC = BaseCICInterpolator<cmplx_t>;
+
+//CIC compensation FIR design (inverse sinc^order passband, frequency sampling with the hamming window)
+//the filter works at the low rate of the CIC (after the decimator or before the interpolator)
+//rate, order, diff_delay - CIC parameters
+//ntaps - number of taps
+//wn - cutoff frequency (0, 1), normalized to the Nyquist frequency of the low rate
+arr_real design_cic_compensator(int rate, int order, int diff_delay, int ntaps, real_t wn = 0.5);
+
+//------------------------------------------------------------------------------
+//Multistage plan of the integer decimation/interpolation
+struct MultistagePlan
+{
+    std::vector<int> factors;   ///< stage factors in the decimation order (from the highest rate)
+    std::vector<int> hlens;     ///< filter half-length of each stage (see `design_multirate_fir`)
+    real_t macs{0};             ///< multiply-accumulates per low rate sample
+};
+
+//Factorization of the decimation/interpolation factor with the minimal number of MACs per low rate sample
+//The filter length of the intermediate stages is estimated with the Kaiser formula for the relaxed transition
+//band (only the aliases in the final band are suppressed), the last stage has the full `hlen` filter.
+//The stages with factor 2 are half-band filters, the number of stages is at most 6.
+//factor - decimation or interpolation factor
+//hlen, astop - parameters of the final stage filter (see `design_multirate_fir`)
+MultistagePlan plan_multistage(int factor, int hlen = 12, real_t astop = 90);
+
+//multistage polyphase FIR decimation (e.g. 48 = 2 * 2 * 3 * 4)
+template<typename T>
+class BaseMultistageDecimator : public BaseResampler<T>
+{
+public:
+    explicit BaseMultistageDecimator(int decim, int hlen = 12, real_t astop = 90);
+
+    explicit BaseMultistageDecimator(const MultistagePlan& plan, real_t astop = 90);
+
+    //in.size() must be a multiple of the decim
+    base_array<T> process(span_t<T> in) final;
+
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    [[nodiscard]] int delay() const noexcept final;
+    [[nodiscard]] int decim_rate() const noexcept final;
+
+    [[nodiscard]] const MultistagePlan& plan() const noexcept {
+        return plan_;
+    }
+
+private:
+    MultistagePlan plan_;
+    int decim_{1};
+    std::vector<std::shared_ptr<BaseResampler<T>>> stages_;
+    std::vector<std::vector<T>> bufs_;   ///< intermediate stage outputs
+};
+
+using MultistageDecimator = BaseMultistageDecimator<real_t>;
+using MultistageDecimatorC = BaseMultistageDecimator<cmplx_t>;
+
+//multistage polyphase FIR interpolation (the decimation plan in the reverse order)
+template<typename T>
+class BaseMultistageInterpolator : public BaseResampler<T>
+{
+public:
+    explicit BaseMultistageInterpolator(int interp, int hlen = 12, real_t astop = 90);
+
+    explicit BaseMultistageInterpolator(const MultistagePlan& plan, real_t astop = 90);
+
+    base_array<T> process(span_t<T> in) final;
+
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    [[nodiscard]] int delay() const noexcept final;
+    [[nodiscard]] int interp_rate() const noexcept final;
+
+    [[nodiscard]] const MultistagePlan& plan() const noexcept {
+        return plan_;
+    }
+
+private:
+    MultistagePlan plan_;
+    int interp_{1};
+    std::vector<std::shared_ptr<BaseResampler<T>>> stages_;
+    std::vector<std::vector<T>> bufs_;   ///< intermediate stage outputs
+};
+
+using MultistageInterpolator = BaseMultistageInterpolator<real_t>;
+using MultistageInterpolatorC = BaseMultistageInterpolator<cmplx_t>;
+
+//------------------------------------------------------------------------------
+template<typename T>
+class FractionalResamplerImpl;
+
+//Arbitrary ratio resampler (e.g. 44100/48000.37 for the clock drift compensation)
+//Polyphase filter bank with linear interpolation between the adjacent phases (first-order Farrow structure),
+//the ratio can be changed between the frames. The output frame size is variable (about in.size() * ratio),
+//see `output_size`. The decim/interp rates are not defined (1).
+template<typename T>
+class BaseFractionalResampler : public BaseResampler<T>
+{
+public:
+    //ratio - output/input sample rate ratio
+    //nphases - number of polyphase branches (the interpolation accuracy)
+    //hlen - half-length of the branch filter (in input samples)
+    //astop - stopband attenuation (dB)
+    explicit BaseFractionalResampler(double ratio, int nphases = 256, int hlen = 12, real_t astop = 90);
+
+    base_array<T> process(span_t<T> in) final;
+
+    //out.size() must be output_size(in.size()), no memory is allocated
+    void process(span_t<T> in, mut_span_t<T> out) final;
+
+    base_array<T> operator()(span_t<T> in) {
+        return this->process(in);
+    }
+
+    //depends on the current position and the ratio
+    [[nodiscard]] int output_size(int size) const noexcept final;
+
+    //change the ratio, the anti-aliasing filter is designed for the initial ratio
+    void set_ratio(double ratio);
+
+    [[nodiscard]] double ratio() const noexcept;
+
+    //filter delay (input samples, rounded)
+    [[nodiscard]] int delay() const noexcept final;
+
+    //filter delay (input samples, fractional)
+    [[nodiscard]] double frac_delay() const noexcept;
+
+private:
+    std::shared_ptr<FractionalResamplerImpl<T>> d_;
+};
+
+using FractionalResampler = BaseFractionalResampler<real_t>;
+using FractionalResamplerC = BaseFractionalResampler<cmplx_t>;
+
 //------------------------------------------------------------------------------
 //resamples the input sequence, x, at p/q times the original sample rate
 //as p/q coefficients, you can use out_fs/in_fs
 
 //n - filter len, uses an antialiasing filter of order 2 × n × max(p,q)
 //beta - shape parameter of Kaiser window
-arr_real resample(span_real x, int p, int q, int n = 10, real_t beta = 5.0);
+arr_f32 resample(span_f32 x, int p, int q, int n = 10, real_t beta = 5.0);
+arr_f64 resample(span_f64 x, int p, int q, int n = 10, real_t beta = 5.0);
+arr_cmplx resample(span_cmplx x, int p, int q, int n = 10, real_t beta = 5.0);
 
 //h - resample FIR filter coefficients
-arr_real resample(span_real x, int p, int q, span_real h);
+arr_f32 resample(span_f32 x, int p, int q, span_real h);
+arr_f64 resample(span_f64 x, int p, int q, span_real h);
+arr_cmplx resample(span_cmplx x, int p, int q, span_real h);
+
+//------------------------------------------------------------------------------
+//upsample, apply FIR filter and downsample (matlab `upfirdn(x, h, p, q)`)
+//the zero-stuffed signal is not formed, each output sample is a dot product with one polyphase branch of h
+//h - filter coefficients (not normalized, unlike the resamplers)
+//result size: ceil(((x.size() - 1) * p + h.size()) / q)
+arr_real upfirdn(span_real x, span_real h, int p = 1, int q = 1);
+arr_cmplx upfirdn(span_cmplx x, span_real h, int p = 1, int q = 1);
 
 }   // namespace dsplib
\ No newline at end of file
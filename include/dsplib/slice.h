@@ -5,6 +5,7 @@
 
 #include <dsplib/assert.h>
 #include <dsplib/iterator.h>
+#include <dsplib/traits.h>
 
 namespace dsplib {
 
@@ -149,6 +150,18 @@ public:
         return *this;
     }
 
+    //evaluate the lazy expression (see expr.h)
+    template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+    mut_slice_t& operator=(const E& rhs) {
+        DSPLIB_ASSERT(count_ == rhs.size(), "Slices size must be equal");
+        T* dst = data_;
+        for (int i = 0; i < count_; ++i) {
+            *dst = rhs[i];
+            dst += stride_;
+        }
+        return *this;
+    }
+
     iterator begin() noexcept {
         return iterator(data_, stride_);
     }
@@ -4,6 +4,7 @@
 #include <dsplib/types.h>
 #include <dsplib/slice.h>
 #include <dsplib/traits.h>
+#include <dsplib/allocator.h>
 
 #include <cassert>
 #include <vector>
@@ -45,7 +46,8 @@ public:
       : mut_span_t(v.data(), v.size()) {
     }
 
-    mut_span_t(std::vector<T>& v)
+    template<class Alloc>
+    mut_span_t(std::vector<T, Alloc>& v)
       : mut_span_t(v.data(), v.size()) {
     }
 
@@ -66,6 +68,11 @@ public:
         return this->data_[i];
     }
 
+    const T& operator[](size_t i) const noexcept {
+        assert(i < size());
+        return this->data_[i];
+    }
+
     //=mut_span<T>
     mut_span_t& operator=(const mut_span_t& rhs) {
         if (this == &rhs) {
@@ -109,6 +116,17 @@ public:
         return *this;
     }
 
+    //evaluate the lazy expression (see expr.h)
+    template<class E, std::enable_if_t<is_expr_v<E>, bool> = true>
+    mut_span_t& operator=(const E& rhs) {
+        DSPLIB_ASSERT(this->count_ == rhs.size(), "Array lengths must be equal");
+        T* x = this->data_;
+        for (int i = 0; i < this->count_; ++i) {
+            x[i] = rhs[i];
+        }
+        return *this;
+    }
+
     template<typename T2, std::enable_if_t<std::is_convertible_v<T2, T>, bool> = true,
              std::enable_if_t<is_scalar_v<T2>, bool> = true>
     mut_span_t& operator=(const T2& rhs) {
@@ -183,7 +201,7 @@ public:
     mut_span_t& operator+=(const T2& rhs) noexcept(is_scalar_v<T2>) {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
+        using R = ResultType<mut_span_t, T2>;
         static_assert(std::is_same_v<T, R>, "The operation changes the type");
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
@@ -202,7 +220,7 @@ public:
     mut_span_t& operator-=(const T2& rhs) noexcept(is_scalar_v<T2>) {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
+        using R = ResultType<mut_span_t, T2>;
         static_assert(std::is_same_v<T, R>, "The operation changes the type");
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
@@ -221,7 +239,7 @@ public:
     mut_span_t& operator*=(const T2& rhs) noexcept(is_scalar_v<T2>) {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
+        using R = ResultType<mut_span_t, T2>;
         static_assert(std::is_same_v<T, R>, "The operation changes the type");
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
@@ -240,7 +258,7 @@ public:
     mut_span_t& operator/=(const T2& rhs) noexcept(is_scalar_v<T2>) {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
+        using R = ResultType<mut_span_t, T2>;
         static_assert(std::is_same_v<T, R>, "The operation changes the type");
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
@@ -256,22 +274,22 @@ public:
     }
 
     //---------------------------------------------------------------------------
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator+(const T2& rhs) const {
         return span_t<T>(*this) + rhs;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator-(const T2& rhs) const {
         return span_t<T>(*this) - rhs;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator*(const T2& rhs) const {
         return span_t<T>(*this) * rhs;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator/(const T2& rhs) const {
         return span_t<T>(*this) / rhs;
     }
@@ -314,7 +332,8 @@ public:
       : span_t(v.data(), v.size()) {
     }
 
-    span_t(const std::vector<T>& v)
+    template<class Alloc>
+    span_t(const std::vector<T, Alloc>& v)
       : span_t(v.data(), v.size()) {
     }
 
@@ -349,12 +368,12 @@ public:
 
     //---------------------------------------------------------------------------
     //arithmetic operators
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator+(const T2& rhs) const {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
-        base_array<R> res(n);
+        using R = ResultType<span_t, T2>;
+        base_array<R> res(n, uninitialized);
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
                 res[i] = x[i] + rhs;
@@ -368,12 +387,12 @@ public:
         return res;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator-(const T2& rhs) const {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
-        base_array<R> res(n);
+        using R = ResultType<span_t, T2>;
+        base_array<R> res(n, uninitialized);
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
                 res[i] = x[i] - rhs;
@@ -387,12 +406,12 @@ public:
         return res;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator*(const T2& rhs) const {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
-        base_array<R> res(n);
+        using R = ResultType<span_t, T2>;
+        base_array<R> res(n, uninitialized);
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
                 res[i] = x[i] * rhs;
@@ -406,12 +425,12 @@ public:
         return res;
     }
 
-    template<class T2>
+    template<class T2, std::enable_if_t<!is_expr_v<T2>, bool> = true>
     auto operator/(const T2& rhs) const {
         auto* x = data();
         const size_t n = size();
-        using R = ResultType<T, T2>;
-        base_array<R> res(n);
+        using R = ResultType<span_t, T2>;
+        base_array<R> res(n, uninitialized);
         if constexpr (is_scalar_v<T2>) {
             for (size_t i = 0; i < n; ++i) {
                 res[i] = x[i] / rhs;
@@ -437,13 +456,13 @@ mut_span_t<T> make_span(T* x, size_t nx) noexcept {
     return mut_span_t<T>(x, nx);
 }
 
-template<typename T>
-span_t<T> make_span(const std::vector<T>& x) noexcept {
+template<typename T, class Alloc>
+span_t<T> make_span(const std::vector<T, Alloc>& x) noexcept {
     return span_t<T>(x.data(), x.size());
 }
 
-template<typename T>
-mut_span_t<T> make_span(std::vector<T>& x) noexcept {
+template<typename T, class Alloc>
+mut_span_t<T> make_span(std::vector<T, Alloc>& x) noexcept {
     return mut_span_t<T>(x.data(), x.size());
 }
 
@@ -460,6 +479,14 @@ mut_span_t<T> make_span(base_array<T>& x) noexcept {
 using span_real = span_t<real_t>;
 using span_cmplx = span_t<cmplx_t>;
 
+using mut_span_real = mut_span_t<real_t>;
+using mut_span_cmplx = mut_span_t<cmplx_t>;
+
+using span_f32 = span_t<float>;
+using span_f64 = span_t<double>;
+using mut_span_f32 = mut_span_t<float>;
+using mut_span_f64 = mut_span_t<double>;
+
 template<typename T>
 class inplace_span_t
 {
@@ -481,8 +508,8 @@ inplace_span_t<T> inplace(base_array<T>& x) {
     return inplace_span_t(make_span(x));
 }
 
-template<typename T>
-inplace_span_t<T> inplace(std::vector<T>& x) {
+template<typename T, class Alloc>
+inplace_span_t<T> inplace(std::vector<T, Alloc>& x) {
     return inplace_span_t(make_span(x));
 }
 
@@ -493,5 +520,7 @@ inplace_span_t<T> inplace(mut_span_t<T> x) {
 
 using inplace_real = inplace_span_t<real_t>;
 using inplace_cmplx = inplace_span_t<cmplx_t>;
+using inplace_f32 = inplace_span_t<float>;
+using inplace_f64 = inplace_span_t<double>;
 
 }   // namespace dsplib
\ No newline at end of file
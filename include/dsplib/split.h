@@ -0,0 +1,213 @@
+#pragma once
+
+#include <dsplib/array.h>
+
+namespace dsplib {
+
+//Split-complex (planar) arrays
+//The real and imaginary parts are stored in separate arrays: re[n], im[n]. The complex multiplication in this
+//layout does not require the re/im shuffles, so the kernels are vectorized like real ones.
+//Use `deinterleave`/`interleave` to convert from/to `cmplx_t` arrays.
+
+//non-mutable split-complex view
+class span_cmplx_split
+{
+public:
+    span_cmplx_split() = default;
+
+    span_cmplx_split(span_real re, span_real im)
+      : re_{re}
+      , im_{im} {
+        DSPLIB_ASSERT(re.size() == im.size(), "real and imag sizes must be equal");
+    }
+
+    [[nodiscard]] span_real re() const noexcept {
+        return re_;
+    }
+
+    [[nodiscard]] span_real im() const noexcept {
+        return im_;
+    }
+
+    [[nodiscard]] int size() const noexcept {
+        return re_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return re_.size() == 0;
+    }
+
+    cmplx_t operator[](int i) const noexcept {
+        return {re_[i], im_[i]};
+    }
+
+    [[nodiscard]] span_cmplx_split slice(int i1, int i2) const {
+        return {re_.slice(i1, i2), im_.slice(i1, i2)};
+    }
+
+private:
+    span_real re_;
+    span_real im_;
+};
+
+//mutable split-complex view
+class mut_span_cmplx_split
+{
+public:
+    mut_span_cmplx_split() = default;
+
+    mut_span_cmplx_split(mut_span_real re, mut_span_real im)
+      : re_{re}
+      , im_{im} {
+        DSPLIB_ASSERT(re.size() == im.size(), "real and imag sizes must be equal");
+    }
+
+    operator span_cmplx_split() const noexcept {
+        return {re_, im_};
+    }
+
+    [[nodiscard]] mut_span_real re() const noexcept {
+        return re_;
+    }
+
+    [[nodiscard]] mut_span_real im() const noexcept {
+        return im_;
+    }
+
+    [[nodiscard]] int size() const noexcept {
+        return re_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return re_.size() == 0;
+    }
+
+    cmplx_t operator[](int i) const noexcept {
+        return {re_[i], im_[i]};
+    }
+
+    void set(int i, const cmplx_t& v) noexcept {
+        re_[i] = v.re;
+        im_[i] = v.im;
+    }
+
+    [[nodiscard]] mut_span_cmplx_split slice(int i1, int i2) const {
+        return {re_.slice(i1, i2), im_.slice(i1, i2)};
+    }
+
+private:
+    mut_span_real re_;
+    mut_span_real im_;
+};
+
+/**
+ * @brief Split-complex (planar) array
+ * @details The parts are stored in two aligned real arrays, the views (`re()`, `im()`, `slice()`) do not copy.
+ */
+class arr_cmplx_split
+{
+public:
+    arr_cmplx_split() = default;
+
+    explicit arr_cmplx_split(int n)
+      : re_(n)
+      , im_(n) {
+    }
+
+    explicit arr_cmplx_split(int n, uninitialized_t)
+      : re_(n, uninitialized)
+      , im_(n, uninitialized) {
+    }
+
+    arr_cmplx_split(arr_real re, arr_real im)
+      : re_{std::move(re)}
+      , im_{std::move(im)} {
+        DSPLIB_ASSERT(re_.size() == im_.size(), "real and imag sizes must be equal");
+    }
+
+    //deinterleave copy of the complex array
+    explicit arr_cmplx_split(span_cmplx x);
+
+    operator span_cmplx_split() const noexcept {
+        return {re_, im_};
+    }
+
+    operator mut_span_cmplx_split() noexcept {
+        return {re_, im_};
+    }
+
+    [[nodiscard]] span_real re() const noexcept {
+        return re_;
+    }
+
+    [[nodiscard]] mut_span_real re() noexcept {
+        return re_;
+    }
+
+    [[nodiscard]] span_real im() const noexcept {
+        return im_;
+    }
+
+    [[nodiscard]] mut_span_real im() noexcept {
+        return im_;
+    }
+
+    [[nodiscard]] int size() const noexcept {
+        return re_.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return re_.empty();
+    }
+
+    cmplx_t operator[](int i) const noexcept {
+        return {re_[i], im_[i]};
+    }
+
+    void set(int i, const cmplx_t& v) noexcept {
+        re_[i] = v.re;
+        im_[i] = v.im;
+    }
+
+    [[nodiscard]] span_cmplx_split slice(int i1, int i2) const {
+        return {re_.slice(i1, i2), im_.slice(i1, i2)};
+    }
+
+    [[nodiscard]] mut_span_cmplx_split slice(int i1, int i2) {
+        return {re_.slice(i1, i2), im_.slice(i1, i2)};
+    }
+
+    //interleaved copy
+    [[nodiscard]] arr_cmplx to_cmplx() const;
+
+private:
+    arr_real re_;
+    arr_real im_;
+};
+
+//-------------------------------------------------------------------------------------------------
+//layout conversion, sizes must be equal
+void deinterleave(span_cmplx x, mut_span_cmplx_split r);
+void interleave(span_cmplx_split x, mut_span_cmplx r);
+
+//non-conjugate dot product, equal `dot(span_cmplx, span_cmplx)`
+cmplx_t dot(span_cmplx_split x1, span_cmplx_split x2);
+
+//squared magnitude
+arr_real abs2(span_cmplx_split x);
+void abs2(span_cmplx_split x, mut_span_real r);
+
+//element-wise multiplication r = x1 * x2 (or x1 * conj(x2)), inplace is allowed (r = x1 or r = x2)
+void multiply(span_cmplx_split x1, span_cmplx_split x2, mut_span_cmplx_split r, bool conj2 = false);
+arr_cmplx_split multiply(span_cmplx_split x1, span_cmplx_split x2, bool conj2 = false);
+
+//FFT with planar input/output, n = x.size()
+//the transform is computed by the interleaved plan (the conversion uses the workspace buffers)
+void fft(span_cmplx_split x, mut_span_cmplx_split r);
+arr_cmplx_split fft(span_cmplx_split x);
+void fft(span_real x, mut_span_cmplx_split r);
+
+void ifft(span_cmplx_split x, mut_span_cmplx_split r);
+arr_cmplx_split ifft(span_cmplx_split x);
+
+}   // namespace dsplib
@@ -8,30 +8,54 @@ namespace dsplib {
 template<typename T>
 class base_array;
 
+//base class of the lazy element-wise expressions (see expr.h)
+struct expr_base
+{};
+
+template<typename E>
+constexpr bool is_expr_v = std::is_base_of_v<expr_base, std::remove_cv_t<std::remove_reference_t<E>>>;
+
 template<bool Cond_, typename Iftrue_, typename Iffalse_>
 using conditional_t = typename std::conditional_t<Cond_, Iftrue_, Iffalse_>;
 
+template<typename T1, typename T2>
+constexpr auto reduce_operator_type() noexcept;
+
+//the real scalar does not change the precision of the real array: `arr_f32 * 0.5` is `arr_f32`
+template<typename Ta, typename Ts>
+constexpr auto reduce_array_scalar_type() noexcept {
+    if constexpr (std::is_floating_point_v<Ta> && std::is_arithmetic_v<Ts>) {
+        return Ta{};
+    } else {
+        return reduce_operator_type<Ta, Ts>();
+    }
+}
+
 //reduce type for `a+b`, `a-b`, `a*b`, `a/b` operators
 template<typename T1, typename T2>
 constexpr auto reduce_operator_type() noexcept {
-    using T1_ = std::remove_reference_t<T1>;
-    using T2_ = std::remove_reference_t<T2>;
+    using T1_ = std::remove_cv_t<std::remove_reference_t<T1>>;
+    using T2_ = std::remove_cv_t<std::remove_reference_t<T2>>;
     if constexpr (is_scalar_v<T1_> && is_scalar_v<T2_>) {
         if constexpr (is_complex_v<T1_> || is_complex_v<T2_>) {
             return cmplx_t{};
+        } else if constexpr (std::is_floating_point_v<T1_> && std::is_same_v<T1_, T2_>) {
+            //the precision is kept for the same types (float op float -> float)
+            return T1_{};
         } else {
+            //mixed precision or integer types -> default type
             return real_t{};
         }
     } else if constexpr (!is_scalar_v<T1_> && !is_scalar_v<T2_>) {
-        using R1 = std::remove_reference_t<decltype(std::declval<T1_>()[0])>;
-        using R2 = std::remove_reference_t<decltype(std::declval<T2_>()[0])>;
+        using R1 = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<T1_>()[0])>>;
+        using R2 = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<T2_>()[0])>>;
         return reduce_operator_type<R1, R2>();
     } else if constexpr (!is_scalar_v<T1_>) {
-        using R1 = std::remove_reference_t<decltype(std::declval<T1_>()[0])>;
-        return reduce_operator_type<R1, T2_>();
+        using R1 = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<T1_>()[0])>>;
+        return reduce_array_scalar_type<R1, T2_>();
     } else {
-        using R2 = std::remove_reference_t<decltype(std::declval<T2_>()[0])>;
-        return reduce_operator_type<T1_, R2>();
+        using R2 = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<T2_>()[0])>>;
+        return reduce_array_scalar_type<R2, T1_>();
     }
 }
 
@@ -72,7 +96,8 @@ constexpr bool is_array_convertible() noexcept {
 template<typename T>
 constexpr bool support_type_for_array() {
     using U = std::remove_cv_t<T>;
-    if constexpr (std::is_same_v<U, real_t>) {
+    //both precisions are supported, `real_t` is the default one
+    if constexpr (std::is_same_v<U, float> || std::is_same_v<U, double>) {
         return true;
     }
     if constexpr (std::is_same_v<U, cmplx_t>) {
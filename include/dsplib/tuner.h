@@ -21,7 +21,7 @@ public:
 
     arr_cmplx process(span_cmplx x) {
         const int n = x.size();
-        arr_cmplx r(n);
+        arr_cmplx r(n, uninitialized);
         for (int i = 0; i < n; i++) {
             const real_t phase = 2 * pi * _freq * _phase / _fs;
             const cmplx_t w = {std::cos(phase), std::sin(phase)};
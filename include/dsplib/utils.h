@@ -15,7 +15,7 @@ using enable_if_some_float_t = std::enable_if<std::is_floating_point<T1>::value
 template<typename T1, typename T2, typename T3, class R = typename enable_if_some_float_t<T1, T2, T3>::type>
 arr_real arange(T1 start, T2 stop, T3 step = 1) {
     const auto n = (int)(std::round((stop - start) / double(step)));
-    arr_real r(n);
+    arr_real r(n, uninitialized);
     for (int i = 0; i < n; ++i) {
         r[i] = start + (i * step);
     }
@@ -28,7 +28,7 @@ inline arr_real arange(real_t stop) {
 
 inline arr_real arange(int start, int stop, int step = 1) {
     const auto n = (int)std::round((stop - start) / double(step));
-    arr_real r(n);
+    arr_real r(n, uninitialized);
     for (int i = 0; i < n; ++i) {
         r[i] = start;
         start += step;
@@ -42,7 +42,8 @@ inline arr_real arange(int stop) {
 
 //join a sequence of arrays
 //TODO: add slice args?
-arr_real concatenate(span_real x1, span_real x2, span_real x3 = {}, span_real x4 = {}, span_real x5 = {});
+arr_f32 concatenate(span_f32 x1, span_f32 x2, span_f32 x3 = {}, span_f32 x4 = {}, span_f32 x5 = {});
+arr_f64 concatenate(span_f64 x1, span_f64 x2, span_f64 x3 = {}, span_f64 x4 = {}, span_f64 x5 = {});
 arr_cmplx concatenate(span_cmplx x1, span_cmplx x2, span_cmplx x3 = {}, span_cmplx x4 = {}, span_cmplx x5 = {});
 
 //create array of all zeros
@@ -52,7 +53,7 @@ inline arr_real zeros(int n) {
 }
 
 inline arr_real ones(int n) {
-    arr_real r(n);
+    arr_real r(n, uninitialized);
     std::fill(r.begin(), r.end(), 1.0);
     return r;
 }
@@ -85,7 +86,8 @@ arr_real from_file(const std::string& file, dtype type = dtype::int16, endian or
                    long count = std::numeric_limits<long>::max());
 
 //add zeros to the end of the array
-arr_real zeropad(span_real x, int n);
+arr_f32 zeropad(span_f32 x, int n);
+arr_f64 zeropad(span_f64 x, int n);
 arr_cmplx zeropad(span_cmplx x, int n);
 
 //delays or advances the signal by the number of samples specified in delay
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+namespace dsplib {
+
+/**
+ * @brief Scratch memory arena for the temporary buffers
+ * @details The library functions (fft/ifft plans, stft/istft, welch, xcorr, gccphat, Channelizer, etc.) take
+ * the temporary buffers from the workspace of the current thread and release them in bulk at the end of the call.
+ * The memory is kept between the calls, so the repeated calls with the same sizes do not allocate.
+ * When the arena grows, the blocks are merged into one block on the next full release.
+ * The arena does not grow above `max_capacity`: the larger requests are taken from the upstream resource directly
+ * and returned to it on `rewind`. The workspace of the thread is limited to 8 MiB, use `trim` to release the memory.
+ * The allocation is a pointer bump, `deallocate` does nothing (std::pmr::monotonic_buffer_resource semantics).
+ * The object is not thread-safe, use one workspace per thread.
+ */
+class Workspace : public std::pmr::memory_resource
+{
+public:
+    //position of the arena top, see `rewind`
+    struct Mark
+    {
+        size_t block{0};
+        size_t offset{0};
+        size_t nlarge{0};
+    };
+
+    explicit Workspace(size_t capacity = 0, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource(),
+                       size_t max_capacity = std::numeric_limits<size_t>::max());
+    ~Workspace() override;
+
+    Workspace(const Workspace&) = delete;
+    Workspace& operator=(const Workspace&) = delete;
+
+    [[nodiscard]] Mark mark() const noexcept;
+
+    //release all the allocations after the mark
+    void rewind(Mark m) noexcept;
+
+    //release all the allocations
+    void reset() noexcept;
+
+    //return the unused blocks to the upstream resource
+    void trim() noexcept;
+
+    //capacity limit of the arena (bytes), the unused blocks above the limit are released
+    void set_max_capacity(size_t bytes) noexcept;
+    [[nodiscard]] size_t max_capacity() const noexcept;
+
+    //total size of the memory blocks (bytes)
+    [[nodiscard]] size_t capacity() const noexcept;
+
+    //current allocated size (bytes)
+    [[nodiscard]] size_t used() const noexcept;
+
+    //number of the memory blocks (and the large buffers) requested from the upstream resource
+    [[nodiscard]] size_t num_upstream_allocs() const noexcept;
+
+    //workspace of the current thread (used by default)
+    static Workspace& local();
+
+    //workspace used by the library in the current thread (`local()` or set by `WorkspaceGuard`)
+    static Workspace& current();
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+private:
+    struct Block
+    {
+        std::byte* data;
+        size_t size;
+        size_t align;
+    };
+
+    void _add_block(size_t size, size_t align);
+    void* _alloc_large(size_t bytes, size_t align);
+    void _release_blocks() noexcept;
+    void _release_large(size_t n) noexcept;
+
+    std::pmr::memory_resource* upstream_;
+    std::vector<Block> blocks_;
+    std::vector<Block> large_;
+    size_t max_capacity_;
+    size_t block_{0};
+    size_t offset_{0};
+    size_t nallocs_{0};
+};
+
+/**
+ * @brief Sets the caller-provided workspace for the library calls in the current thread
+ * @code
+ *  dsplib::Workspace ws(1 << 20);
+ *  dsplib::WorkspaceGuard guard(ws);
+ *  auto spec = dsplib::stft(x, 512);
+ * @endcode
+ */
+class WorkspaceGuard
+{
+public:
+    explicit WorkspaceGuard(Workspace& ws) noexcept;
+    ~WorkspaceGuard();
+
+    WorkspaceGuard(const WorkspaceGuard&) = delete;
+    WorkspaceGuard& operator=(const WorkspaceGuard&) = delete;
+
+private:
+    Workspace* prev_;
+};
+
+}   // namespace dsplib
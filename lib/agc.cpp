@@ -20,8 +20,8 @@ template<typename T>
 static Agc::Result<T> _process(AgcImpl& agc, span_t<T> x) {
     static const auto e = dsplib::eps();
     const int nx = x.size();
-    base_array<T> out(nx);
-    arr_real gain(nx);
+    base_array<T> out(nx, uninitialized);
+    arr_real gain(nx, uninitialized);
     for (int i = 0; i < nx; ++i) {
         const auto input_power = agc.maflt(abs2(x[i])) + e;
         DSPLIB_ASSUME(input_power > 0);
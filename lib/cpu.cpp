@@ -0,0 +1,51 @@
+#include "dsplib/cpu.h"
+#include "dsplib/assert.h"
+
+#include "internal/dispatch.h"
+
+#include <atomic>
+
+namespace dsplib {
+
+namespace {
+
+SimdLevel _detect_simd_level() noexcept {
+#ifdef DSPLIB_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::Baseline;
+}
+
+std::atomic<SimdLevel>& _active_simd_level() noexcept {
+    static std::atomic<SimdLevel> level{detected_simd_level()};
+    return level;
+}
+
+}   // namespace
+
+SimdLevel detected_simd_level() noexcept {
+    static const SimdLevel level = _detect_simd_level();
+    return level;
+}
+
+SimdLevel simd_level() noexcept {
+    return _active_simd_level().load(std::memory_order_relaxed);
+}
+
+void set_simd_level(SimdLevel level) {
+    DSPLIB_ASSERT(int(level) <= int(detected_simd_level()), "SIMD level is not supported");
+    _active_simd_level().store(level, std::memory_order_relaxed);
+}
+
+void reset_simd_level() noexcept {
+    _active_simd_level().store(detected_simd_level(), std::memory_order_relaxed);
+}
+
+}   // namespace dsplib
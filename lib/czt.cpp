@@ -72,7 +72,7 @@ CztPlan::CztPlan(int n, int m, cmplx_t w, cmplx_t a)
 }
 
 arr_cmplx CztPlan::solve(span_t<cmplx_t> x) const {
-    arr_cmplx r(_d->_n);
+    arr_cmplx r(_d->_n, uninitialized);
     _d->solve(x, r);
     return r;
 }
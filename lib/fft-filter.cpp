@@ -2,30 +2,33 @@
 
 namespace dsplib {
 
-template<typename T>
+template<typename T, typename Th>
 class FftFilterImpl
 {
 public:
-    explicit FftFilterImpl(span_t<T> h)
+    using R = ResultType<T, Th>;
+
+    explicit FftFilterImpl(span_t<Th> h)
       : _nfft{int(1) << nextpow2(2 * h.size())}
       , _m{h.size()}
       , _n{_nfft - h.size() + 1}
       , _x(_nfft)
       , _olap(_m - 1) {
         assert(_n > _m);
-        _h = fft(conj(h), _nfft);
+        _h = fft(conj(base_array<Th>(h)), _nfft);
     }
 
-    base_array<T> process(span_t<T> x) {
+    base_array<R> process(span_t<T> x) {
         const int nr = (x.size() + _nx) / _n * _n;
-        base_array<T> r(nr);
+        base_array<R> r(nr);
         auto* pr = r.data();
         for (const auto& val : x) {
             _x[_nx] = val;
             _nx += 1;
             if (_nx == _n) {
-                base_array<T> ry;
-                if constexpr (std::is_same_v<T, real_t>) {
+                //for real input `fft(_x)` uses the r2c transform
+                base_array<R> ry;
+                if constexpr (std::is_same_v<R, real_t>) {
                     ry = std::move(irfft(fft(_x) * _h));   //TODO: use n/2+1 multiply
                 } else {
                     ry = std::move(ifft(fft(_x) * _h));
@@ -55,37 +58,27 @@ private:
     int _n{0};
     base_array<T> _x;
     arr_cmplx _h;
-    base_array<T> _olap;
+    base_array<R> _olap;
 };
 
-template<>
-FftFilter<real_t>::FftFilter(span_t<real_t> h) {
-    d_ = std::make_shared<FftFilterImpl<real_t>>(h);
-}
-
-template<>
-FftFilter<cmplx_t>::FftFilter(span_t<cmplx_t> h) {
-    d_ = std::make_shared<FftFilterImpl<cmplx_t>>(h);
-}
-
-template<>
-base_array<real_t> FftFilter<real_t>::process(span_t<real_t> x) {
-    return d_->process(x);
+template<typename T, typename Th>
+FftFilter<T, Th>::FftFilter(span_t<Th> h) {
+    d_ = std::make_shared<FftFilterImpl<T, Th>>(h);
 }
 
-template<>
-base_array<cmplx_t> FftFilter<cmplx_t>::process(span_t<cmplx_t> x) {
+template<typename T, typename Th>
+base_array<typename FftFilter<T, Th>::R> FftFilter<T, Th>::process(span_t<T> x) {
     return d_->process(x);
 }
 
-template<>
-int FftFilter<real_t>::block_size() const {
+template<typename T, typename Th>
+int FftFilter<T, Th>::block_size() const {
     return d_->block_size();
 }
 
-template<>
-int FftFilter<cmplx_t>::block_size() const {
-    return d_->block_size();
-}
+template class FftFilter<real_t, real_t>;
+template class FftFilter<cmplx_t, cmplx_t>;
+template class FftFilter<real_t, cmplx_t>;
+template class FftFilter<cmplx_t, real_t>;
 
-}   // namespace dsplib
\ No newline at end of file
+}   // namespace dsplib
@@ -2,6 +2,8 @@
 
 #include <dsplib/ifft.h>
 
+#include "internal/scratch.h"
+
 namespace dsplib {
 
 class CmplxIfftPlan : public IfftPlanC
@@ -21,7 +23,8 @@ public:
         const int n = fft_->size();
         DSPLIB_ASSERT(x.size() == n, "array size error");
         DSPLIB_ASSERT(x.size() == r.size(), "array size error");
-        arr_cmplx t(n);
+        ScratchScope scratch;
+        auto t = scratch.alloc<cmplx_t>(n);
         const real_t m = real_t(1) / n;
         for (int i = 0; i < n; ++i) {
             t[i].re = x[i].re * m;
@@ -1,4 +1,5 @@
 #include "fft/fact-fft.h"
+#include "internal/scratch.h"
 
 #include <dsplib/math.h>
 #include <dsplib/utils.h>
@@ -180,7 +181,7 @@ FactorFFTPlan::FactorFFTPlan(int n)
 }
 
 [[nodiscard]] arr_cmplx FactorFFTPlan::solve(span_t<cmplx_t> x) const {
-    arr_cmplx r(_n);
+    arr_cmplx r(_n, uninitialized);
     this->solve(x, r);
     return r;
 }
@@ -194,7 +195,8 @@ void FactorFFTPlan::solve(span_t<cmplx_t> x, mut_span_t<cmplx_t> r) const {
 void FactorFFTPlan::solve(inplace_span_t<cmplx_t> r) const {
     auto x = r.get();
     DSPLIB_ASSERT(x.size() == _n, "input array size is not equal fft size");
-    arr_cmplx tmp(_n);
+    ScratchScope scratch;
+    auto tmp = scratch.alloc<cmplx_t>(_n);
     _facfft(_plan.get(), x.data(), tmp.data(), _twiddle.data(), _n);
 }
 
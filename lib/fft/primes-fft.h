@@ -30,7 +30,7 @@ public:
     }
 
     [[nodiscard]] arr_cmplx solve(span_t<cmplx_t> x) const final {
-        arr_cmplx r(n_);
+        arr_cmplx r(n_, uninitialized);
         this->solve(x, r);
         return r;
     }
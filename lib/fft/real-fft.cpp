@@ -3,6 +3,7 @@
 #include <dsplib/math.h>
 
 #include "fft/real-fft.h"
+#include "internal/scratch.h"
 
 namespace dsplib {
 
@@ -14,7 +15,7 @@ RealFftPlan::RealFftPlan(int n)
 }
 
 arr_cmplx RealFftPlan::solve(span_t<real_t> x) const {
-    arr_cmplx r(n_);
+    arr_cmplx r(n_, uninitialized);
     this->solve(x, r);
     return r;
 }
@@ -26,8 +27,14 @@ void RealFftPlan::solve(span_t<real_t> x, mut_span_t<cmplx_t> r) const {
     DSPLIB_ASSERT(r.size() == n_, "Output size must be equal FFT size");
     const int n2 = n_ / 2;
 
-    arr_cmplx z(make_span(reinterpret_cast<const cmplx_t*>(x.data()), n2));
-    const auto Z = fft_->solve(z * 0.5);
+    ScratchScope scratch;
+    auto z = scratch.alloc<cmplx_t>(n2);
+    const auto* px = reinterpret_cast<const cmplx_t*>(x.data());
+    for (int i = 0; i < n2; ++i) {
+        z[i] = px[i] * real_t(0.5);
+    }
+    auto Z = scratch.alloc<cmplx_t>(n2);
+    fft_->solve(z, Z);
 
     {
         const auto Xe = Z[0] + conj(Z[0]);
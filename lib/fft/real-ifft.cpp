@@ -1,4 +1,5 @@
 #include "fft/real-ifft.h"
+#include "internal/scratch.h"
 
 namespace dsplib {
 
@@ -53,7 +54,7 @@ RealIfftPlan::RealIfftPlan(int n)
 }
 
 arr_real RealIfftPlan::solve(span_t<cmplx_t> x) const {
-    arr_real r(n_);
+    arr_real r(n_, uninitialized);
     this->solve(x, r);
     return r;
 }
@@ -64,7 +65,8 @@ void RealIfftPlan::solve(span_t<cmplx_t> x, mut_span_t<real_t> r) const {
     DSPLIB_ASSERT(r.size() == n_, "output size must be n");
 
     const real_t dn = real_t(1) / n_;
-    std::vector<cmplx_t> Z(n_ / 2);
+    ScratchScope scratch;
+    auto Z = scratch.alloc<cmplx_t>(n_ / 2);
     for (int i = 0; i < n_ / 2; ++i) {
         const auto v = x[n_ / 2 - i].conj();
         const cmplx_t Xe = (x[i] + v) * dn;
@@ -73,7 +75,8 @@ void RealIfftPlan::solve(span_t<cmplx_t> x, mut_span_t<real_t> r) const {
         Z[i].im = -Xe.im - Xo.re;
     }
 
-    const auto z = fft_->solve(Z);
+    auto z = scratch.alloc<cmplx_t>(n_ / 2);
+    fft_->solve(Z, z);
     for (int i = 0; i < n_ / 2; ++i) {
         r[2 * i] = z[i].re;
         r[2 * i + 1] = -z[i].im;
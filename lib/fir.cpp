@@ -10,8 +10,8 @@ namespace dsplib {
 
 namespace {
 
-template<class T>
-void _conv(T* restrict x, const T* restrict h, int nh, int nx) {
+template<class T, class Th>
+void _conv(T* restrict x, const Th* restrict h, int nh, int nx) {
     const int nr = nx - nh + 1;
     DSPLIB_ASSUME(nr > 0);
     for (int i = 0; i < nr; ++i) {
@@ -23,6 +23,22 @@ void _conv(T* restrict x, const T* restrict h, int nh, int nx) {
     }
 }
 
+//real input, complex taps: y = sum(x * conj(h)), two real MACs per tap
+void _conv_rc(const real_t* restrict x, const cmplx_t* restrict h, cmplx_t* restrict y, int nh, int nx) {
+    const int nr = nx - nh + 1;
+    DSPLIB_ASSUME(nr > 0);
+    for (int i = 0; i < nr; ++i) {
+        real_t re = 0;
+        real_t im = 0;
+        for (int k = 0; k < nh; ++k) {
+            const auto& hk = h[nh - k - 1];
+            re += x[i + k] * hk.re;
+            im -= x[i + k] * hk.im;
+        }
+        y[i] = {re, im};
+    }
+}
+
 arr_real _lowpass_fir(int n, real_t wn, span_real win) {
     if (win.size() != (n + 1)) {
         DSPLIB_THROW("Window must be n+1 elements");
@@ -111,14 +127,35 @@ bool _is_antisymmetric(span_real h) {
 
 //-------------------------------------------------------------------------------------------------
 template<>
-void FirFilter<real_t>::conv(mut_span_t<real_t> x, span_t<real_t> h) {
+template<>
+void FirFilter<float>::conv(mut_span_t<float> x, span_t<float> h) {
     _conv(x.data(), h.data(), h.size(), x.size());
 }
 template<>
+template<>
+void FirFilter<double>::conv(mut_span_t<double> x, span_t<double> h) {
+    _conv(x.data(), h.data(), h.size(), x.size());
+}
+template<>
+template<>
 void FirFilter<cmplx_t>::conv(mut_span_t<cmplx_t> x, span_t<cmplx_t> h) {
     _conv(x.data(), h.data(), h.size(), x.size());
 }
 
+template<>
+template<>
+void FirFilter<real_t, cmplx_t>::conv(span_t<real_t> x, span_t<cmplx_t> h, mut_span_t<cmplx_t> r) {
+    DSPLIB_ASSERT(r.size() == x.size() - h.size() + 1, "output size mismatch");
+    _conv_rc(x.data(), h.data(), r.data(), h.size(), x.size());
+}
+
+//complex input, real taps: cmplx * real product (two real MACs per tap)
+template<>
+template<>
+void FirFilter<cmplx_t, real_t>::conv(mut_span_t<cmplx_t> x, span_t<real_t> h) {
+    _conv(x.data(), h.data(), h.size(), x.size());
+}
+
 //----------------------------------------------------------------------------------------------
 arr_real fir1(int n, real_t wn, FilterType ftype, const arr_real& win) {
     assert(n > 0);
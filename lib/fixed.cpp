@@ -0,0 +1,341 @@
+#include "dsplib/fixed.h"
+
+#include "internal/dispatch.h"
+#include "internal/lru-cache.h"
+#include "internal/scratch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace dsplib {
+
+namespace {
+
+constexpr int FFT_CACHE_SIZE = DSPLIB_FFT_CACHE_SIZE;
+
+//the integer range of Q31 is exactly representable only in double
+template<typename T>
+T _to_fixed(real_t x) noexcept {
+    constexpr double scale = double(std::numeric_limits<T>::max()) + 1;
+    constexpr double vmin = std::numeric_limits<T>::min();
+    constexpr double vmax = std::numeric_limits<T>::max();
+    return T(std::clamp(std::round(double(x) * scale), vmin, vmax));
+}
+
+//rounding of the accumulator with `nshift` fractional bits to Q15/Q31
+template<typename T>
+T _round_acc(int64_t acc, int nshift) noexcept {
+    const int64_t v = (acc + (int64_t(1) << (nshift - 1))) >> nshift;
+    return T(std::clamp<int64_t>(v, std::numeric_limits<T>::min(), std::numeric_limits<T>::max()));
+}
+
+//The dot kernels are dispatched by the CPU features (see internal/dispatch.h), the independent lanes of
+//the accumulator make the loops vectorizable (the integer sums do not depend on the order).
+constexpr int DOT_LANES = 8;
+
+//The pairs of the Q15 products are summed in int32 (the pmaddwd pattern) and widened to the int64 lanes.
+//The pair sum overflows int32 only for (-2^15)^2 + (-2^15)^2 = 2^31, so `pair - 1` (range [-2^31 + 2^16 - 1,
+//2^31 - 1]) is accumulated and the number of pairs is added to the result.
+struct DotQ15Kernel
+{
+    static int64_t run(const q15_t* restrict x1, const q15_t* restrict x2, int n) noexcept {
+        int64_t acc[DOT_LANES] = {};
+        const int npairs = n / 2;
+        int i = 0;
+        for (; i + 2 * DOT_LANES <= n; i += 2 * DOT_LANES) {
+            for (int k = 0; k < DOT_LANES; ++k) {
+                const int j = i + 2 * k;
+                const uint32_t p = uint32_t(int32_t(x1[j]) * x2[j]) + uint32_t(int32_t(x1[j + 1]) * x2[j + 1]);
+                acc[k] += int32_t(p - 1);
+            }
+        }
+        for (; i + 2 <= n; i += 2) {
+            const uint32_t p = uint32_t(int32_t(x1[i]) * x2[i]) + uint32_t(int32_t(x1[i + 1]) * x2[i + 1]);
+            acc[0] += int32_t(p - 1);
+        }
+        int64_t r = npairs;
+        if (i < n) {
+            r += int32_t(x1[i]) * x2[i];
+        }
+        for (int k = 0; k < DOT_LANES; ++k) {
+            r += acc[k];
+        }
+        return r;
+    }
+};
+
+//Q31 products are truncated to 48 bits in the int64 lanes
+struct DotQ31Kernel
+{
+    static int64_t run(const q31_t* restrict x1, const q31_t* restrict x2, int n) noexcept {
+        int64_t acc[DOT_LANES] = {};
+        int i = 0;
+        for (; i + DOT_LANES <= n; i += DOT_LANES) {
+            for (int k = 0; k < DOT_LANES; ++k) {
+                acc[k] += (int64_t(x1[i + k]) * x2[i + k]) >> 14;
+            }
+        }
+        int64_t r = 0;
+        for (; i < n; ++i) {
+            r += (int64_t(x1[i]) * x2[i]) >> 14;
+        }
+        for (int k = 0; k < DOT_LANES; ++k) {
+            r += acc[k];
+        }
+        return r;
+    }
+};
+
+//Q15 accumulator has 30 fractional bits, Q31 products are truncated to 48 bits (16 guard bits)
+template<typename T>
+struct FixedTraits;
+
+template<>
+struct FixedTraits<q15_t>
+{
+    static constexpr int acc_bits = 30;
+    using dot_kernel = DotQ15Kernel;
+};
+
+template<>
+struct FixedTraits<q31_t>
+{
+    static constexpr int acc_bits = 48;
+    using dot_kernel = DotQ31Kernel;
+};
+
+//y[i] = round(sum(z[i * decim + k] * h[k])), the coefficients are in the forward order
+template<typename T>
+struct FixedFirKernel
+{
+    static void run(const T* restrict z, const T* restrict h, T* restrict y, int ny, int nh, int decim) noexcept {
+        constexpr int nshift = FixedTraits<T>::acc_bits - (sizeof(T) * 8 - 1);
+        for (int i = 0; i < ny; ++i) {
+            const int64_t acc = FixedTraits<T>::dot_kernel::run(z + i * decim, h, nh);
+            y[i] = _round_acc<T>(acc, nshift);
+        }
+    }
+};
+
+template<typename T, typename Fn>
+aligned_vector<T> _elementwise(span_t<T> x1, span_t<T> x2, Fn fn) {
+    DSPLIB_ASSERT(x1.size() == x2.size(), "arrays sizes must be equal");
+    const int n = x1.size();
+    auto r = uninitialized_vector<T>(n);
+    for (int i = 0; i < n; ++i) {
+        r[i] = fn(x1[i], x2[i]);
+    }
+    return r;
+}
+
+//Q15 complex multiplication with rounding, the result is not saturated
+void _cmul_q15(cmplx_q15_t a, cmplx_q15_t w, int32_t& re, int32_t& im) noexcept {
+    re = (int32_t(a.re) * w.re - int32_t(a.im) * w.im + (1 << 14)) >> 15;
+    im = (int32_t(a.re) * w.im + int32_t(a.im) * w.re + (1 << 14)) >> 15;
+}
+
+//bit-reverse permutation and Q15 twiddles of the radix-2 fft
+struct FftQ15Table
+{
+    std::vector<int> bitrev;
+    aligned_vector<cmplx_q15_t> w;   ///< exp(-2j * pi * k / n), k = [0, n / 2)
+};
+
+std::shared_ptr<const FftQ15Table> _make_fft_q15_table(int n) {
+    auto tab = std::make_shared<FftQ15Table>();
+    int nbits = 0;
+    while ((1 << nbits) < n) {
+        ++nbits;
+    }
+    tab->bitrev.resize(n);
+    for (int i = 0; i < n; ++i) {
+        int k = 0;
+        for (int b = 0; b < nbits; ++b) {
+            k |= ((i >> b) & 1) << (nbits - 1 - b);
+        }
+        tab->bitrev[i] = k;
+    }
+    tab->w.resize(n / 2);
+    for (int k = 0; k < n / 2; ++k) {
+        const real_t phi = -2 * pi * k / n;
+        tab->w[k] = {_to_fixed<q15_t>(std::cos(phi)), _to_fixed<q15_t>(std::sin(phi))};
+    }
+    return tab;
+}
+
+//the tables are cached like the floating-point fft plans
+std::shared_ptr<const FftQ15Table> _fft_q15_table(int n) {
+    if constexpr (FFT_CACHE_SIZE > 0) {
+        DSPLIB_CACHE_T LRUCache<int, std::shared_ptr<const FftQ15Table>> cache{FFT_CACHE_SIZE};
+        if (!cache.exists(n)) {
+            auto tab = _make_fft_q15_table(n);
+            cache.put(n, tab);
+            return tab;
+        }
+        return cache.get(n);
+    } else {
+        return _make_fft_q15_table(n);
+    }
+}
+
+}   // namespace
+
+//-------------------------------------------------------------------------------------------------
+arr_q15 to_q15(span_real x) {
+    auto r = uninitialized_vector<q15_t>(x.size());
+    for (int i = 0; i < x.size(); ++i) {
+        r[i] = _to_fixed<q15_t>(x[i]);
+    }
+    return r;
+}
+
+arr_q31 to_q31(span_real x) {
+    auto r = uninitialized_vector<q31_t>(x.size());
+    for (int i = 0; i < x.size(); ++i) {
+        r[i] = _to_fixed<q31_t>(x[i]);
+    }
+    return r;
+}
+
+arr_cmplx_q15 to_q15(span_cmplx x) {
+    auto r = uninitialized_vector<cmplx_q15_t>(x.size());
+    for (int i = 0; i < x.size(); ++i) {
+        r[i] = {_to_fixed<q15_t>(x[i].re), _to_fixed<q15_t>(x[i].im)};
+    }
+    return r;
+}
+
+arr_real from_q15(span_q15 x) {
+    constexpr real_t scale = real_t(1) / (1 << 15);
+    arr_real r(x.size(), uninitialized);
+    for (int i = 0; i < x.size(); ++i) {
+        r[i] = x[i] * scale;
+    }
+    return r;
+}
+
+arr_real from_q31(span_q31 x) {
+    constexpr real_t scale = real_t(1) / (int64_t(1) << 31);
+    arr_real r(x.size(), uninitialized);
+    for (int i = 0; i < x.size(); ++i) {
+        r[i] = x[i] * scale;
+    }
+    return r;
+}
+
+arr_cmplx from_q15(span_cmplx_q15 x) {
+    constexpr real_t scale = real_t(1) / (1 << 15);
+    arr_cmplx r(x.size(), uninitialized);
+    for (int i = 0; i < x.size(); ++i) {
+        r[i] = {x[i].re * scale, x[i].im * scale};
+    }
+    return r;
+}
+
+//-------------------------------------------------------------------------------------------------
+arr_q15 add_q15(span_q15 x1, span_q15 x2) {
+    return _elementwise(x1, x2, [](q15_t a, q15_t b) {
+        return add_q15(a, b);
+    });
+}
+
+arr_q15 sub_q15(span_q15 x1, span_q15 x2) {
+    return _elementwise(x1, x2, [](q15_t a, q15_t b) {
+        return sub_q15(a, b);
+    });
+}
+
+arr_q15 mul_q15(span_q15 x1, span_q15 x2) {
+    return _elementwise(x1, x2, [](q15_t a, q15_t b) {
+        return mul_q15(a, b);
+    });
+}
+
+arr_q31 add_q31(span_q31 x1, span_q31 x2) {
+    return _elementwise(x1, x2, [](q31_t a, q31_t b) {
+        return add_q31(a, b);
+    });
+}
+
+arr_q31 sub_q31(span_q31 x1, span_q31 x2) {
+    return _elementwise(x1, x2, [](q31_t a, q31_t b) {
+        return sub_q31(a, b);
+    });
+}
+
+arr_q31 mul_q31(span_q31 x1, span_q31 x2) {
+    return _elementwise(x1, x2, [](q31_t a, q31_t b) {
+        return mul_q31(a, b);
+    });
+}
+
+//-------------------------------------------------------------------------------------------------
+int64_t dot_q15(span_q15 x1, span_q15 x2) {
+    DSPLIB_ASSERT(x1.size() == x2.size(), "arrays sizes must be equal");
+    return dispatch<DotQ15Kernel>(x1.data(), x2.data(), x1.size());
+}
+
+int64_t dot_q31(span_q31 x1, span_q31 x2) {
+    DSPLIB_ASSERT(x1.size() == x2.size(), "arrays sizes must be equal");
+    return dispatch<DotQ31Kernel>(x1.data(), x2.data(), x1.size());
+}
+
+//-------------------------------------------------------------------------------------------------
+arr_cmplx_q15 fft_q15(span_cmplx_q15 x) {
+    const int n = x.size();
+    DSPLIB_ASSERT(n > 0 && (n & (n - 1)) == 0, "fft size must be a power of 2");
+
+    const auto tab = _fft_q15_table(n);
+    const auto& w = tab->w;
+
+    //bit-reversed copy
+    auto r = uninitialized_vector<cmplx_q15_t>(n);
+    for (int i = 0; i < n; ++i) {
+        r[tab->bitrev[i]] = x[i];
+    }
+
+    //radix-2 stages with the 1/2 scaling
+    for (int len = 2; len <= n; len <<= 1) {
+        const int half = len / 2;
+        const int step = n / len;
+        for (int i = 0; i < n; i += len) {
+            for (int j = 0; j < half; ++j) {
+                const cmplx_q15_t a = r[i + j];
+                int32_t tre, tim;
+                _cmul_q15(r[i + j + half], w[j * step], tre, tim);
+                r[i + j] = {sat_q15((a.re + tre) >> 1), sat_q15((a.im + tim) >> 1)};
+                r[i + j + half] = {sat_q15((a.re - tre) >> 1), sat_q15((a.im - tim) >> 1)};
+            }
+        }
+    }
+    return r;
+}
+
+//-------------------------------------------------------------------------------------------------
+template<typename T>
+void FixedFirFilter<T>::conv(aligned_vector<T>& d, span_t<T> hr, span_t<T> x, mut_span_t<T> y, int decim) {
+    const int nh = hr.size();
+    const int nd = nh - 1;
+    const int nx = x.size();
+    DSPLIB_ASSERT(y.size() * decim == nx, "output size mismatch");
+
+    //z = [d | x]
+    ScratchScope scratch;
+    auto z = scratch.alloc<T>(nd + nx);
+    std::copy(d.begin(), d.end(), z.begin());
+    std::copy(x.begin(), x.end(), z.begin() + nd);
+
+    dispatch<FixedFirKernel<T>>(z.data(), hr.data(), y.data(), y.size(), nh, decim);
+
+    if (nd > 0) {
+        std::memcpy(d.data(), z.data() + nx, nd * sizeof(T));
+    }
+}
+
+template class FixedFirFilter<q15_t>;
+template class FixedFirFilter<q31_t>;
+
+}   // namespace dsplib
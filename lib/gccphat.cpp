@@ -1,56 +1,68 @@
 #include <dsplib/gccphat.h>
 
+#include "internal/scratch.h"
+
 namespace dsplib {
 
-GccphatRes gccphat(span_real sig, span_real refsig, int fs) {
-    const real_t ts = 1.0 / fs;
-    auto X1 = fft(sig);
-    auto X2 = fft(refsig);
-    conj(inplace(X2));
-    auto Y = X1 * X2;
-    const auto R = ifft(Y / abs(Y));
+namespace {
+
+//phase transform of the cross-spectrum: corr = ifft(Y / |Y|), Y = X1 * conj(X2)
+void _gccphat_corr(span_real sig, span_cmplx X2, mut_span_cmplx corr) {
+    const int M = X2.size();
+    DSPLIB_ASSERT(sig.size() == M, "Signal sizes must be equal");
+    ScratchScope scratch;
+    auto X1 = scratch.alloc<cmplx_t>(M);
+    fft_plan_r(M)->solve(sig, X1);
+    for (int i = 0; i < M; ++i) {
+        const auto Y = X1[i] * conj(X2[i]);
+        X1[i] = Y / abs(Y);
+    }
+    ifft_plan_c(M)->solve(X1, corr);
+}
+
+real_t _gccphat_delay(span_cmplx R, real_t ts) {
     const auto n = argmax(R);
     const int M = R.size();
     const int M2 = R.size() / 2;
     auto peak = peakloc(R, n);
-    real_t delay = 0;
     if (peak < M2) {
-        delay = peak * ts;
-    } else {
-        delay = (peak - M) * ts;
+        return peak * ts;
     }
+    return (peak - M) * ts;
+}
+
+}   // namespace
+
+GccphatRes gccphat(span_real sig, span_real refsig, int fs) {
+    const real_t ts = 1.0 / fs;
+    const int M = refsig.size();
+    ScratchScope scratch;
+    auto X2 = scratch.alloc<cmplx_t>(M);
+    fft_plan_r(M)->solve(refsig, X2);
 
     GccphatRes res;
-    res.tau = delay;
-    res.corr = R;
+    res.corr = arr_cmplx(M, uninitialized);
+    _gccphat_corr(sig, X2, res.corr);
+    res.tau = _gccphat_delay(res.corr, ts);
     return res;
 }
 
 MGccphatRes gccphat(std::vector<span_real> sig, span_real refsig, int fs) {
     const real_t ts = 1.0 / fs;
-    auto X2 = fft(refsig);
-    conj(inplace(X2));
-    const int M = X2.size();
-    const int M2 = M / 2;
+    const int M = refsig.size();
+    ScratchScope scratch;
+    auto X2 = scratch.alloc<cmplx_t>(M);
+    fft_plan_r(M)->solve(refsig, X2);
+
     MGccphatRes res;
     res.tau = zeros(sig.size());
     res.corr.resize(sig.size());
     for (size_t i = 0; i < sig.size(); i++) {
-        auto X1 = fft(sig[i]);
-        auto Y = X1 * X2;
-        const auto R = ifft(Y / abs(Y));
-        const auto n = argmax(R);
-        auto peak = peakloc(R, n);
-        real_t delay = 0;
-        if (peak < M2) {
-            delay = peak * ts;
-        } else {
-            delay = (peak - M) * ts;
-        }
-        res.tau[i] = delay;
-        res.corr[i] = R;
+        res.corr[i] = arr_cmplx(M, uninitialized);
+        _gccphat_corr(sig[i], X2, res.corr[i]);
+        res.tau[i] = _gccphat_delay(res.corr[i], ts);
     }
     return res;
 }
 
-}   // namespace dsplib
\ No newline at end of file
+}   // namespace dsplib
@@ -48,7 +48,7 @@ HilbertFilter::HilbertFilter(span_real h)
 arr_cmplx HilbertFilter::process(span_real s) {
     const int n = s.size();
 
-    arr_cmplx r(n);
+    arr_cmplx r(n, uninitialized);
 
     const auto re = _d.process(s);
     for (int i = 0; i < n; ++i) {
@@ -0,0 +1,521 @@
+#include "dsplib/iir.h"
+#include "dsplib/math.h"
+#include "dsplib/utils.h"
+#include "dsplib/fft.h"
+#include "dsplib/ifft.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace dsplib {
+
+namespace {
+
+constexpr int SOS_ROW = 6;
+constexpr int SOS_NCOEFS = 5;
+
+//minimal FIR length for the FFT convolution in `filtfilt`
+constexpr int FILTFILT_FFT_MIN_TAPS = 200;
+
+//checked before the state allocation
+int _check_channels(int num_channels) {
+    DSPLIB_ASSERT(num_channels > 0, "number of channels must be positive");
+    return num_channels;
+}
+
+//normalize coefficients by a[0] and pad to the same length
+std::pair<arr_real, arr_real> _normalize_tf(span_real b, span_real a) {
+    DSPLIB_ASSERT(!b.empty() && !a.empty(), "filter coefficients must not be empty");
+    DSPLIB_ASSERT(a[0] != 0, "first denominator coefficient must be non-zero");
+    const int n = max(a.size(), b.size());
+    auto bb = zeropad(b, n);
+    auto aa = zeropad(a, n);
+    const real_t a0 = a[0];
+    bb /= a0;
+    aa /= a0;
+    return {bb, aa};
+}
+
+//sos [b0 b1 b2 a0 a1 a2] -> [b0 b1 b2 a1 a2] with a0=1
+arr_real _normalize_sos(span_real sos) {
+    DSPLIB_ASSERT(!sos.empty() && (sos.size() % SOS_ROW == 0), "sos size must be a multiple of 6");
+    const int ns = sos.size() / SOS_ROW;
+    arr_real c(ns * SOS_NCOEFS);
+    for (int i = 0; i < ns; ++i) {
+        const real_t* s = sos.data() + i * SOS_ROW;
+        DSPLIB_ASSERT(s[3] != 0, "section a0 coefficient must be non-zero");
+        real_t* pc = c.data() + i * SOS_NCOEFS;
+        pc[0] = s[0] / s[3];
+        pc[1] = s[1] / s[3];
+        pc[2] = s[2] / s[3];
+        pc[3] = s[4] / s[3];
+        pc[4] = s[5] / s[3];
+    }
+    return c;
+}
+
+//transposed direct form II, n - filter order
+template<typename T>
+void _tdf2(const real_t* restrict b, const real_t* restrict a, T* restrict z, int n, T* restrict x, int nx) noexcept {
+    if (n == 0) {
+        for (int i = 0; i < nx; ++i) {
+            x[i] = b[0] * x[i];
+        }
+        return;
+    }
+
+    for (int i = 0; i < nx; ++i) {
+        const T xi = x[i];
+        const T yi = b[0] * xi + z[0];
+        for (int k = 0; k < n - 1; ++k) {
+            z[k] = b[k + 1] * xi + z[k + 1] - a[k + 1] * yi;
+        }
+        z[n - 1] = b[n] * xi - a[n] * yi;
+        x[i] = yi;
+    }
+}
+
+//biquad section, c = [b0 b1 b2 a1 a2]
+template<typename T>
+void _biquad(const real_t* restrict c, T* restrict z, T* restrict x, int nx) noexcept {
+    const real_t b0 = c[0];
+    const real_t b1 = c[1];
+    const real_t b2 = c[2];
+    const real_t a1 = c[3];
+    const real_t a2 = c[4];
+    T z1 = z[0];
+    T z2 = z[1];
+    for (int i = 0; i < nx; ++i) {
+        const T xi = x[i];
+        const T yi = b0 * xi + z1;
+        z1 = b1 * xi - a1 * yi + z2;
+        z2 = b2 * xi - a2 * yi;
+        x[i] = yi;
+    }
+    z[0] = z1;
+    z[1] = z2;
+}
+
+//biquad section for interleaved channels, z = [z1[nc], z2[nc]]
+template<typename T>
+void _biquad_mc(const real_t* restrict c, T* restrict z, T* restrict x, int nx, int nc) noexcept {
+    const real_t b0 = c[0];
+    const real_t b1 = c[1];
+    const real_t b2 = c[2];
+    const real_t a1 = c[3];
+    const real_t a2 = c[4];
+    T* restrict z1 = z;
+    T* restrict z2 = z + nc;
+    for (int i = 0; i < nx; ++i) {
+        T* restrict px = x + i * nc;
+        for (int k = 0; k < nc; ++k) {
+            const T xi = px[k];
+            const T yi = b0 * xi + z1[k];
+            z1[k] = b1 * xi - a1 * yi + z2[k];
+            z2[k] = b2 * xi - a2 * yi;
+            px[k] = yi;
+        }
+    }
+}
+
+}   // namespace
+
+//-------------------------------------------------------------------------------------------------
+template<typename T>
+IirFilter<T>::IirFilter(span_real b, span_real a) {
+    std::tie(b_, a_) = _normalize_tf(b, a);
+    z_ = base_array<T>(b_.size() - 1);
+}
+
+template<typename T>
+IirFilter<T>::IirFilter(span_real b, span_real a, span_t<T> zi)
+  : IirFilter(b, a) {
+    DSPLIB_ASSERT(zi.size() == z_.size(), "initial conditions size must be max(len(b), len(a)) - 1");
+    if (!zi.empty()) {
+        z_.slice(0, indexing::end) = zi;
+    }
+}
+
+template<typename T>
+base_array<T> IirFilter<T>::process(span_t<T> x) {
+    base_array<T> r(x);
+    this->process(inplace(r));
+    return r;
+}
+
+template<typename T>
+void IirFilter<T>::process(inplace_span_t<T> x) {
+    auto s = x.get();
+    _tdf2(b_.data(), a_.data(), z_.data(), z_.size(), s.data(), s.size());
+}
+
+template<typename T>
+void IirFilter<T>::reset() noexcept {
+    std::fill(z_.begin(), z_.end(), T(0));
+}
+
+template class IirFilter<real_t>;
+template class IirFilter<cmplx_t>;
+
+//-------------------------------------------------------------------------------------------------
+template<typename T>
+SosFilter<T>::SosFilter(span_real sos, real_t g)
+  : ns_{sos.size() / SOS_ROW}
+  , g_{g}
+  , c_{_normalize_sos(sos)}
+  , z_(2 * ns_) {
+}
+
+template<typename T>
+base_array<T> SosFilter<T>::process(span_t<T> x) {
+    base_array<T> r(x);
+    this->process(inplace(r));
+    return r;
+}
+
+template<typename T>
+void SosFilter<T>::process(inplace_span_t<T> x) {
+    auto s = x.get();
+    if (g_ != 1) {
+        s *= g_;
+    }
+    //section-by-section processing of the whole frame, the section state stays in registers
+    for (int i = 0; i < ns_; ++i) {
+        _biquad(c_.data() + i * SOS_NCOEFS, z_.data() + 2 * i, s.data(), s.size());
+    }
+}
+
+template<typename T>
+void SosFilter<T>::reset() noexcept {
+    std::fill(z_.begin(), z_.end(), T(0));
+}
+
+template class SosFilter<real_t>;
+template class SosFilter<cmplx_t>;
+
+//-------------------------------------------------------------------------------------------------
+template<typename T>
+class MultiChannelSosFilterImpl
+{
+public:
+    explicit MultiChannelSosFilterImpl(span_real sos, int num_channels, real_t g)
+      : nc_{_check_channels(num_channels)}
+      , ns_{sos.size() / SOS_ROW}
+      , g_{g}
+      , c_{_normalize_sos(sos)}
+      , z_(2 * ns_ * nc_) {
+    }
+
+    void process(mut_span_t<T> x) {
+        DSPLIB_ASSERT(x.size() % nc_ == 0, "input size must be a multiple of the number of channels");
+        if (g_ != 1) {
+            x *= g_;
+        }
+        const int nx = x.size() / nc_;
+        for (int i = 0; i < ns_; ++i) {
+            _biquad_mc(c_.data() + i * SOS_NCOEFS, z_.data() + 2 * i * nc_, x.data(), nx, nc_);
+        }
+    }
+
+    std::vector<base_array<T>> process(const std::vector<base_array<T>>& x) {
+        DSPLIB_ASSERT(int(x.size()) == nc_, "number of input channels mismatch");
+        const int n = x[0].size();
+        for (const auto& ch : x) {
+            DSPLIB_ASSERT(ch.size() == n, "all channels must have the same size");
+        }
+
+        //planar -> interleaved
+        inter_.resize(n * nc_);
+        for (int c = 0; c < nc_; ++c) {
+            const T* px = x[c].data();
+            for (int i = 0; i < n; ++i) {
+                inter_[i * nc_ + c] = px[i];
+            }
+        }
+
+        this->process(make_span(inter_));
+
+        //interleaved -> planar
+        std::vector<base_array<T>> r(nc_, base_array<T>(n));
+        for (int c = 0; c < nc_; ++c) {
+            T* pr = r[c].data();
+            for (int i = 0; i < n; ++i) {
+                pr[i] = inter_[i * nc_ + c];
+            }
+        }
+        return r;
+    }
+
+    [[nodiscard]] int num_channels() const noexcept {
+        return nc_;
+    }
+
+    void reset() noexcept {
+        std::fill(z_.begin(), z_.end(), T(0));
+    }
+
+private:
+    const int nc_;
+    const int ns_;
+    const real_t g_;
+    arr_real c_;
+    base_array<T> z_;         ///< delays [ns][2][nc]
+    std::vector<T> inter_;    ///< interleaved planar input
+};
+
+template<typename T>
+MultiChannelSosFilter<T>::MultiChannelSosFilter(span_real sos, int num_channels, real_t g)
+  : d_{std::make_shared<MultiChannelSosFilterImpl<T>>(sos, num_channels, g)} {
+}
+
+template<typename T>
+base_array<T> MultiChannelSosFilter<T>::process(span_t<T> x) {
+    base_array<T> r(x);
+    d_->process(make_span(r));
+    return r;
+}
+
+template<typename T>
+void MultiChannelSosFilter<T>::process(inplace_span_t<T> x) {
+    d_->process(x.get());
+}
+
+template<typename T>
+std::vector<base_array<T>> MultiChannelSosFilter<T>::process(const std::vector<base_array<T>>& x) {
+    return d_->process(x);
+}
+
+template<typename T>
+int MultiChannelSosFilter<T>::num_channels() const noexcept {
+    return d_->num_channels();
+}
+
+template<typename T>
+void MultiChannelSosFilter<T>::reset() noexcept {
+    d_->reset();
+}
+
+template class MultiChannelSosFilter<real_t>;
+template class MultiChannelSosFilter<cmplx_t>;
+
+//-------------------------------------------------------------------------------------------------
+arr_real filter(span_real b, span_real a, span_real x) {
+    return IirFilterR(b, a).process(x);
+}
+
+arr_cmplx filter(span_real b, span_real a, span_cmplx x) {
+    return IirFilterC(b, a).process(x);
+}
+
+std::pair<arr_real, arr_real> filter(span_real b, span_real a, span_real x, span_real zi) {
+    IirFilterR flt(b, a, zi);
+    auto y = flt.process(x);
+    return {y, flt.state()};
+}
+
+std::pair<arr_cmplx, arr_cmplx> filter(span_real b, span_real a, span_cmplx x, span_cmplx zi) {
+    IirFilterC flt(b, a, zi);
+    auto y = flt.process(x);
+    return {y, flt.state()};
+}
+
+arr_real sosfilt(span_real sos, span_real x) {
+    return SosFilterR(sos).process(x);
+}
+
+arr_cmplx sosfilt(span_real sos, span_cmplx x) {
+    return SosFilterC(sos).process(x);
+}
+
+//-------------------------------------------------------------------------------------------------
+namespace {
+
+//steady-state delays of the step response (as scipy `lfilter_zi`), b and a are normalized
+arr_real _tdf2_zi(const arr_real& b, const arr_real& a) {
+    const int n = b.size() - 1;
+    arr_real zi(n);
+    const real_t sa = sum(a);
+    DSPLIB_ASSERT(sa != 0, "filter has a pole at z=1, initial conditions are undefined");
+    const real_t y = sum(b) / sa;
+    real_t acc = 0;
+    for (int k = n - 1; k >= 0; --k) {
+        acc += b[k + 1] - a[k + 1] * y;
+        zi[k] = acc;
+    }
+    return zi;
+}
+
+template<typename T>
+class Tdf2Kernel
+{
+public:
+    explicit Tdf2Kernel(const arr_real& b, const arr_real& a)
+      : b_{b}
+      , a_{a}
+      , z_(b.size() - 1) {
+    }
+
+    mut_span_t<T> state() noexcept {
+        return make_span(z_);
+    }
+
+    void process(mut_span_t<T> x) noexcept {
+        _tdf2(b_.data(), a_.data(), z_.data(), z_.size(), x.data(), x.size());
+    }
+
+private:
+    const arr_real& b_;
+    const arr_real& a_;
+    base_array<T> z_;
+};
+
+//overlap-add FFT convolution, the overlap tail is the same as the TDF2 state of the FIR filter
+template<typename T>
+class OlaKernel
+{
+public:
+    explicit OlaKernel(const arr_real& h)
+      : nh_{h.size()}
+      , nfft_{1 << nextpow2(2 * nh_)}
+      , nb_{nfft_ - nh_ + 1}
+      , z_(nh_ - 1)
+      , buf_(nfft_)
+      , spec_(nfft_) {
+        H_ = fft(h, nfft_);
+        if constexpr (std::is_same_v<T, real_t>) {
+            fft_r_ = fft_plan_r(nfft_);
+            ifft_r_ = ifft_plan_r(nfft_);
+        } else {
+            fft_c_ = fft_plan_c(nfft_);
+            ifft_c_ = ifft_plan_c(nfft_);
+        }
+    }
+
+    mut_span_t<T> state() noexcept {
+        return make_span(z_);
+    }
+
+    void process(mut_span_t<T> x) {
+        const int nx = x.size();
+        const int nz = nh_ - 1;
+        for (int pos = 0; pos < nx; pos += nb_) {
+            const int nl = std::min(nb_, nx - pos);
+            T* px = x.data() + pos;
+            std::copy(px, px + nl, buf_.data());
+            std::fill(buf_.data() + nl, buf_.data() + nfft_, T(0));
+            _fftconv();
+            for (int i = 0; i < nl; ++i) {
+                px[i] = buf_[i] + ((i < nz) ? z_[i] : T(0));
+            }
+            for (int i = 0; i < nz; ++i) {
+                z_[i] = buf_[nl + i] + ((nl + i < nz) ? z_[nl + i] : T(0));
+            }
+        }
+    }
+
+private:
+    void _fftconv() {
+        if constexpr (std::is_same_v<T, real_t>) {
+            const int n2 = nfft_ / 2 + 1;
+            fft_r_->solve(buf_, spec_);
+            for (int i = 0; i < n2; ++i) {
+                spec_[i] *= H_[i];
+            }
+            ifft_r_->solve(span_cmplx(spec_.data(), n2), buf_);
+        } else {
+            fft_c_->solve(buf_, spec_);
+            spec_ *= H_;
+            ifft_c_->solve(spec_, buf_);
+        }
+    }
+
+    const int nh_;
+    const int nfft_;
+    const int nb_;   ///< input block size
+    base_array<T> z_;
+    base_array<T> buf_;
+    arr_cmplx spec_;
+    arr_cmplx H_;
+    std::shared_ptr<FftPlanR> fft_r_;
+    std::shared_ptr<IfftPlanR> ifft_r_;
+    std::shared_ptr<FftPlanC> fft_c_;
+    std::shared_ptr<IfftPlanC> ifft_c_;
+};
+
+//forward-backward processing of the signal with odd reflection of the edges (3 * order samples)
+template<typename T, typename Kernel>
+void _filtfilt(Kernel& flt, const arr_real& zi, mut_span_t<T> x) {
+    const int nz = zi.size();
+    const int nfact = 3 * nz;
+    const int n = x.size();
+    DSPLIB_ASSERT(n > nfact, "input size must be greater than 3 * filter order");
+
+    base_array<T> pre(nfact, uninitialized);
+    base_array<T> post(nfact, uninitialized);
+    for (int i = 0; i < nfact; ++i) {
+        pre[i] = real_t(2) * x[0] - x[nfact - i];
+        post[i] = real_t(2) * x[n - 1] - x[n - 2 - i];
+    }
+
+    auto z = flt.state();
+    for (int i = 0; i < nz; ++i) {
+        z[i] = zi[i] * pre[0];
+    }
+    flt.process(pre);
+    flt.process(x);
+    flt.process(post);
+
+    std::reverse(post.begin(), post.end());
+    for (int i = 0; i < nz; ++i) {
+        z[i] = zi[i] * post[0];
+    }
+    flt.process(post);
+    std::reverse(x.begin(), x.end());
+    flt.process(x);
+    std::reverse(x.begin(), x.end());
+}
+
+template<typename T>
+void _filtfilt(span_real b, span_real a, mut_span_t<T> x) {
+    const auto [bb, aa] = _normalize_tf(b, a);
+    if (bb.size() == 1) {
+        x *= (bb[0] * bb[0]);
+        return;
+    }
+
+    const auto zi = _tdf2_zi(bb, aa);
+    const bool is_fir = std::all_of(aa.begin() + 1, aa.end(), [](real_t v) {
+        return v == 0;
+    });
+    if (is_fir && (bb.size() >= FILTFILT_FFT_MIN_TAPS)) {
+        OlaKernel<T> flt(bb);
+        _filtfilt(flt, zi, x);
+    } else {
+        Tdf2Kernel<T> flt(bb, aa);
+        _filtfilt(flt, zi, x);
+    }
+}
+
+}   // namespace
+
+arr_real filtfilt(span_real b, span_real a, span_real x) {
+    arr_real r(x);
+    _filtfilt(b, a, make_span(r));
+    return r;
+}
+
+arr_cmplx filtfilt(span_real b, span_real a, span_cmplx x) {
+    arr_cmplx r(x);
+    _filtfilt(b, a, make_span(r));
+    return r;
+}
+
+void filtfilt(span_real b, span_real a, inplace_real x) {
+    _filtfilt(b, a, x.get());
+}
+
+void filtfilt(span_real b, span_real a, inplace_cmplx x) {
+    _filtfilt(b, a, x.get());
+}
+
+}   // namespace dsplib
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <dsplib/cpu.h>
+#include <dsplib/defs.h>
+
+//runtime selection of the kernel ISA
+//The kernel is a struct with the static `run` function written as a plain loop, `dispatch<Kernel>(args...)`
+//calls the copy of `run` compiled for the current `simd_level()` (the copies are instantiated in the
+//translation unit of the call).
+//example:
+//  struct SumKernel {
+//      static double run(const double* x, int n) noexcept { ... }
+//  };
+//  double s = dispatch<SumKernel>(x.data(), x.size());
+
+#if defined(DSPLIB_SIMD_DISPATCH) && (defined(__x86_64__) || defined(__i386__)) &&                                    \
+  (defined(__GNUC__) || defined(__clang__))
+#define DSPLIB_X86_DISPATCH
+//`flatten` inlines the generic kernel into the target-specific wrapper, so it is compiled for this ISA
+#define DSPLIB_TARGET_AVX2 __attribute__((target("avx2,fma"), flatten))
+#define DSPLIB_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx512vl,avx2,fma"), flatten))
+#endif
+
+namespace dsplib {
+
+#ifdef DSPLIB_X86_DISPATCH
+
+template<typename Kernel, typename... Args>
+DSPLIB_TARGET_AVX2 auto _dispatch_avx2(Args... args) {
+    return Kernel::run(args...);
+}
+
+template<typename Kernel, typename... Args>
+DSPLIB_TARGET_AVX512 auto _dispatch_avx512(Args... args) {
+    return Kernel::run(args...);
+}
+
+#endif
+
+template<typename Kernel, typename... Args>
+auto dispatch(Args... args) {
+#ifdef DSPLIB_X86_DISPATCH
+    switch (simd_level()) {
+    case SimdLevel::AVX512:
+        return _dispatch_avx512<Kernel>(args...);
+    case SimdLevel::AVX2:
+        return _dispatch_avx2<Kernel>(args...);
+    case SimdLevel::Baseline:
+        break;
+    }
+#endif
+    return Kernel::run(args...);
+}
+
+}   // namespace dsplib
@@ -7,7 +7,7 @@
 
 namespace dsplib {
 
-template<typename Key, typename Value>
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
 class LRUCache
 {
 public:
@@ -54,7 +54,7 @@ public:
 
 private:
     std::list<KeyValue_t> items_list_;
-    std::unordered_map<Key, ListIterator_t> items_map_;
+    std::unordered_map<Key, ListIterator_t, Hash> items_map_;
     size_t max_size_;
 };
 
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <dsplib/parallel.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+//block decomposition of the large arrays for the thread pool (see dsplib/parallel.h)
+//The partition depends only on the array size, so the results are reproducible for any number of threads.
+//example:
+//  const real_t s = parallel_reduce<real_t>(
+//    n, [x](int i1, int i2) { return dispatch<SumKernel>(x + i1, i2 - i1); }, std::plus<>());
+
+namespace dsplib {
+
+//number of elements in the block
+constexpr int PARALLEL_BLOCK = 1 << 16;
+
+//true if the array of size `n` is processed by the thread pool
+bool use_parallel(int n) noexcept;
+
+//call fn(i) for i in [0, ntasks) on the thread pool, returns after all the calls
+//the calling thread takes the tasks too, the busy pool is replaced by the calling thread
+void parallel_run(int ntasks, const std::function<void(int)>& fn);
+
+//call fn(i1, i2) for the blocks [i1, i2) of [0, n), or fn(0, n) for the small arrays
+template<typename Fn>
+void parallel_for(int n, Fn fn) {
+    if (!use_parallel(n)) {
+        fn(0, n);
+        return;
+    }
+    const int nblocks = (n + PARALLEL_BLOCK - 1) / PARALLEL_BLOCK;
+    parallel_run(nblocks, [&](int b) {
+        fn(b * PARALLEL_BLOCK, std::min(n, (b + 1) * PARALLEL_BLOCK));
+    });
+}
+
+//fn(i1, i2) -> T for the blocks of [0, n), the results are combined pairwise by op(left, right)
+//((b0 + b1) + (b2 + b3)) + ...
+template<typename T, typename Fn, typename Op>
+T parallel_reduce(int n, Fn fn, Op op) {
+    if (!use_parallel(n)) {
+        return fn(0, n);
+    }
+    const int nblocks = (n + PARALLEL_BLOCK - 1) / PARALLEL_BLOCK;
+    std::vector<T> part(nblocks);
+    parallel_run(nblocks, [&](int b) {
+        part[b] = fn(b * PARALLEL_BLOCK, std::min(n, (b + 1) * PARALLEL_BLOCK));
+    });
+    for (int step = 1; step < nblocks; step *= 2) {
+        for (int i = 0; i + step < nblocks; i += 2 * step) {
+            part[i] = op(part[i], part[i + step]);
+        }
+    }
+    return part[0];
+}
+
+}   // namespace dsplib
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <dsplib/span.h>
+#include <dsplib/workspace.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace dsplib {
+
+//temporary buffers of the processing call, taken from the workspace of the current thread
+//all buffers are released at the end of the scope, the scopes can be nested (LIFO)
+//example:
+//  ScratchScope scratch;
+//  auto t = scratch.alloc<cmplx_t>(n);   //uninitialized
+//  plan->solve(x, t);
+class ScratchScope
+{
+public:
+    ScratchScope()
+      : ws_{Workspace::current()}
+      , mark_{ws_.mark()} {
+    }
+
+    ~ScratchScope() {
+        ws_.rewind(mark_);
+    }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    template<typename T>
+    mut_span_t<T> alloc(int n) {
+        static_assert(std::is_trivially_destructible_v<T>, "type must be trivially destructible");
+        auto* p = static_cast<T*>(ws_.allocate(n * sizeof(T), DSPLIB_ARRAY_ALIGN));
+        return mut_span_t<T>(p, n);
+    }
+
+    template<typename T>
+    mut_span_t<T> zeros(int n) {
+        auto r = this->alloc<T>(n);
+        std::fill(r.begin(), r.end(), T(0));
+        return r;
+    }
+
+    template<typename T>
+    mut_span_t<T> copy(span_t<T> x) {
+        auto r = this->alloc<T>(x.size());
+        std::copy(x.begin(), x.end(), r.begin());
+        return r;
+    }
+
+private:
+    Workspace& ws_;
+    Workspace::Mark mark_;
+};
+
+}   // namespace dsplib
@@ -5,6 +5,8 @@
 #include "dsplib/types.h"
 #include "dsplib/utils.h"
 
+#include "internal/parallel.h"
+
 #include <algorithm>
 #include <cmath>
 #include <complex>
@@ -13,80 +15,151 @@
 
 namespace dsplib {
 
+namespace {
+
+//index of the first max/min element (as std::max_element/std::min_element),
+//the blocks are combined in order, so the first of the equal elements is kept
+template<typename T>
+int _argmax(span_t<T> x) {
+    return parallel_reduce<int>(
+      x.size(),
+      [&x](int i1, int i2) {
+          return i1 + std::distance(x.begin() + i1, std::max_element(x.begin() + i1, x.begin() + i2));
+      },
+      [&x](int i1, int i2) {
+          return (x[i1] < x[i2]) ? i2 : i1;
+      });
+}
+
+template<typename T>
+int _argmin(span_t<T> x) {
+    return parallel_reduce<int>(
+      x.size(),
+      [&x](int i1, int i2) {
+          return i1 + std::distance(x.begin() + i1, std::min_element(x.begin() + i1, x.begin() + i2));
+      },
+      [&x](int i1, int i2) {
+          return (x[i2] < x[i1]) ? i2 : i1;
+      });
+}
+
+//abs(x)^2 without the conversion to `real_t`
+template<typename T>
+auto _abs2(const T& x) noexcept {
+    if constexpr (is_complex_v<T>) {
+        return x.abs2();
+    } else {
+        return x * x;
+    }
+}
+
+}   // namespace
+
 //-------------------------------------------------------------------------------------------------
-real_t max(span_real arr) {
-    return *std::max_element(arr.begin(), arr.end());
+float max(span_f32 arr) {
+    return arr[_argmax(arr)];
+}
+
+double max(span_f64 arr) {
+    return arr[_argmax(arr)];
 }
 
 cmplx_t max(span_cmplx arr) {
-    return *std::max_element(arr.begin(), arr.end());
+    return arr[_argmax(arr)];
 }
 
 //-------------------------------------------------------------------------------------------------
-int argmax(span_real arr) {
-    return std::distance(arr.begin(), std::max_element(arr.begin(), arr.end()));
+int argmax(span_f32 arr) {
+    return _argmax(arr);
+}
+
+int argmax(span_f64 arr) {
+    return _argmax(arr);
 }
 
 int argmax(span_cmplx arr) {
-    return std::distance(arr.begin(), std::max_element(arr.begin(), arr.end()));
+    return _argmax(arr);
 }
 
 //-------------------------------------------------------------------------------------------------
-real_t min(span_real arr) {
-    return *std::min_element(arr.begin(), arr.end());
+float min(span_f32 arr) {
+    return arr[_argmin(arr)];
+}
+
+double min(span_f64 arr) {
+    return arr[_argmin(arr)];
 }
 
 cmplx_t min(span_cmplx arr) {
-    return *std::min_element(arr.begin(), arr.end());
+    return arr[_argmin(arr)];
 }
 
 //-------------------------------------------------------------------------------------------------
-real_t peak2peak(span_real arr) {
+template<typename T>
+static T _peak2peak(span_t<T> arr) {
     auto p = std::minmax_element(arr.begin(), arr.end());
     return (*p.second - *p.first);
 }
 
+float peak2peak(span_f32 arr) {
+    return _peak2peak(arr);
+}
+
+double peak2peak(span_f64 arr) {
+    return _peak2peak(arr);
+}
+
 cmplx_t peak2peak(span_cmplx arr) {
-    auto p = std::minmax_element(arr.begin(), arr.end());
-    return (*p.second - *p.first);
+    return _peak2peak(arr);
 }
 
 //-------------------------------------------------------------------------------------------------
-int argmin(span_real arr) {
-    return std::distance(arr.begin(), std::min_element(arr.begin(), arr.end()));
+int argmin(span_f32 arr) {
+    return _argmin(arr);
+}
+
+int argmin(span_f64 arr) {
+    return _argmin(arr);
 }
 
 int argmin(span_cmplx arr) {
-    return std::distance(arr.begin(), std::min_element(arr.begin(), arr.end()));
+    return _argmin(arr);
 }
 
 //-------------------------------------------------------------------------------------------------
-void abs(inplace_real arr) noexcept {
-    auto x = arr.get();
-    const int nx = x.size();
-    for (int i = 0; i < nx; ++i) {
-        x[i] = std::fabs(x[i]);
-    }
+template<typename T>
+static void _abs(mut_span_t<T> x) noexcept {
+    parallel_for(x.size(), [&x](int i1, int i2) {
+        for (int i = i1; i < i2; ++i) {
+            x[i] = std::fabs(x[i]);
+        }
+    });
 }
 
-arr_real abs(span_real arr) noexcept {
-    arr_real r(arr);
-    abs(inplace(r));
-    return r;
+void abs(inplace_f32 arr) noexcept {
+    _abs(arr.get());
 }
 
-real_t abs(real_t v) noexcept {
-    return std::fabs(v);
+void abs(inplace_f64 arr) noexcept {
+    _abs(arr.get());
 }
 
-arr_real abs(span_cmplx arr) noexcept {
-    arr_real r(arr.size());
-    for (int i = 0; i < r.size(); ++i) {
-        r[i] = std::sqrt(arr[i].re * arr[i].re + arr[i].im * arr[i].im);
-    }
+arr_f32 abs(span_f32 arr) noexcept {
+    arr_f32 r(arr);
+    _abs(make_span(r));
     return r;
 }
 
+arr_f64 abs(span_f64 arr) noexcept {
+    arr_f64 r(arr);
+    _abs(make_span(r));
+    return r;
+}
+
+real_t abs(real_t v) noexcept {
+    return std::fabs(v);
+}
+
 real_t abs(cmplx_t v) noexcept {
     return std::sqrt(v.re * v.re + v.im * v.im);
 }
@@ -103,11 +176,19 @@ cmplx_t round(const cmplx_t& x) noexcept {
 template<typename T>
 void _round(mut_span_t<T> x) noexcept {
     for (int i = 0; i < x.size(); ++i) {
-        x[i] = round(x[i]);
+        if constexpr (is_complex_v<T>) {
+            x[i] = round(x[i]);
+        } else {
+            x[i] = std::round(x[i]);
+        }
     }
 }
 
-void round(inplace_real arr) noexcept {
+void round(inplace_f32 arr) noexcept {
+    _round(arr.get());
+}
+
+void round(inplace_f64 arr) noexcept {
     _round(arr.get());
 }
 
@@ -115,9 +196,15 @@ void round(inplace_cmplx arr) noexcept {
     _round(arr.get());
 }
 
-arr_real round(span_real arr) noexcept {
-    arr_real r(arr);
-    round(inplace(r));
+arr_f32 round(span_f32 arr) noexcept {
+    arr_f32 r(arr);
+    _round(make_span(r));
+    return r;
+}
+
+arr_f64 round(span_f64 arr) noexcept {
+    arr_f64 r(arr);
+    _round(make_span(r));
     return r;
 }
 
@@ -160,7 +247,7 @@ arr_cmplx cumsum(span_cmplx x, Direction dir) {
 //-------------------------------------------------------------------------------------------------
 std::pair<arr_real, arr_int> sort(const arr_real& x, Direction dir) {
     const int n = x.size();
-    arr_int index(n);
+    arr_int index(n, uninitialized);
     std::iota(index.begin(), index.end(), 0);
 
     if (issorted(x, dir)) {
@@ -205,24 +292,41 @@ bool issorted(span_real x, Direction dir) {
 }
 
 //-------------------------------------------------------------------------------------------------
-real_t mean(span_real arr) {
-    real_t s = sum(arr);
+template<typename T>
+static T _mean(span_t<T> arr) {
+    const T s = sum(arr);
     return s / arr.size();
 }
 
+float mean(span_f32 arr) {
+    return _mean(arr);
+}
+
+double mean(span_f64 arr) {
+    return _mean(arr);
+}
+
 cmplx_t mean(span_cmplx arr) {
-    cmplx_t s = sum(arr);
-    return s / arr.size();
+    return _mean(arr);
 }
 
 //-------------------------------------------------------------------------------------------------
-real_t stddev(span_real arr) {
-    auto x = arr_real(arr);
-    real_t m = mean(x);
+template<typename T>
+static T _stddev(span_t<T> arr) {
+    auto x = base_array<T>(arr);
+    const T m = mean(x);
     x -= m;
     return rms(x);
 }
 
+float stddev(span_f32 arr) {
+    return _stddev(arr);
+}
+
+double stddev(span_f64 arr) {
+    return _stddev(arr);
+}
+
 real_t stddev(span_cmplx arr) {
     auto x = arr_cmplx(arr);
     cmplx_t m = mean(x);
@@ -231,13 +335,22 @@ real_t stddev(span_cmplx arr) {
 }
 
 //-------------------------------------------------------------------------------------------------
-real_t median(span_real arr) {
-    arr_real r(arr);
+template<typename T>
+static T _median(span_t<T> arr) {
+    base_array<T> r(arr);
     std::sort(r.begin(), r.end());
     const int n = r.size();
     return (n % 2 == 1) ? (r[n / 2]) : ((r[n / 2] + r[n / 2 - 1]) / 2);
 }
 
+float median(span_f32 arr) {
+    return _median(arr);
+}
+
+double median(span_f64 arr) {
+    return _median(arr);
+}
+
 //-------------------------------------------------------------------------------------------------
 arr_real real(span_cmplx x) {
     arr_real r(x.size());
@@ -267,7 +380,7 @@ real_t imag(const cmplx_t& x) {
 arr_cmplx complex(span_real re, span_real im) {
     DSPLIB_ASSERT(re.size() == im.size(), "array sizes are different");
     const int n = re.size();
-    arr_cmplx r(n);
+    arr_cmplx r(n, uninitialized);
     for (int i = 0; i < n; ++i) {
         r[i].re = re[i];
         r[i].im = im[i];
@@ -284,33 +397,6 @@ arr_cmplx complex(span_real re) {
 }
 
 //-------------------------------------------------------------------------------------------------
-arr_real log(span_real arr) {
-    const int n = arr.size();
-    arr_real r(n);
-    for (int i = 0; i < n; ++i) {
-        r[i] = std::log(arr[i]);
-    }
-    return r;
-}
-
-arr_real log2(span_real arr) {
-    const int n = arr.size();
-    arr_real r(n);
-    for (int i = 0; i < n; ++i) {
-        r[i] = std::log2(arr[i]);
-    }
-    return r;
-}
-
-arr_real log10(span_real arr) {
-    const int n = arr.size();
-    arr_real r(n);
-    for (int i = 0; i < n; ++i) {
-        r[i] = std::log10(arr[i]);
-    }
-    return r;
-}
-
 real_t log(const real_t& x) {
     return std::log(x);
 }
@@ -323,23 +409,6 @@ real_t log10(const real_t& x) {
     return std::log10(x);
 }
 
-//-------------------------------------------------------------------------------------------------
-arr_real sin(span_real arr) {
-    arr_real r(arr);
-    for (int i = 0; i < r.size(); ++i) {
-        r[i] = std::sin(r[i]);
-    }
-    return r;
-}
-
-arr_real cos(span_real arr) {
-    arr_real r(arr);
-    for (int i = 0; i < r.size(); ++i) {
-        r[i] = std::cos(r[i]);
-    }
-    return r;
-}
-
 //-------------------------------------------------------------------------------------------------
 void conj(inplace_cmplx x) noexcept {
     auto r = x.get();
@@ -474,87 +543,52 @@ real_t sqrt(real_t x) noexcept {
     return std::sqrt(x);
 }
 
-void sqrt(inplace_real arr) noexcept {
-    auto x = arr.get();
+template<typename T>
+static void _sqrt(mut_span_t<T> x) noexcept {
     for (int i = 0; i < x.size(); ++i) {
         x[i] = std::sqrt(x[i]);
     }
 }
 
-arr_real sqrt(span_real arr) noexcept {
-    arr_real r(arr);
-    sqrt(inplace(r));
-    return r;
+void sqrt(inplace_f32 arr) noexcept {
+    _sqrt(arr.get());
 }
 
-//-------------------------------------------------------------------------------------------------
-arr_real angle(span_cmplx arr) {
-    arr_real r(arr.size());
-    for (int i = 0; i < r.size(); ++i) {
-        r[i] = angle(arr[i]);
-    }
+void sqrt(inplace_f64 arr) noexcept {
+    _sqrt(arr.get());
+}
+
+arr_f32 sqrt(span_f32 arr) noexcept {
+    arr_f32 r(arr);
+    _sqrt(make_span(r));
     return r;
 }
 
-real_t angle(cmplx_t v) {
-    real_t d = 0;
-    if (v.re < 0) {
-        d = (v.im > 0) ? (pi) : (-pi);
-    } else {
-        d = 0;
-    }
-    return std::atan(v.im / v.re) + d;
+arr_f64 sqrt(span_f64 arr) noexcept {
+    arr_f64 r(arr);
+    _sqrt(make_span(r));
+    return r;
 }
 
 //-------------------------------------------------------------------------------------------------
-arr_real exp(span_real arr) {
-    arr_real r(arr);
-    for (int i = 0; i < r.size(); ++i) {
-        r[i] = std::exp(r[i]);
-    }
-    return r;
+real_t angle(cmplx_t v) {
+    return std::atan2(v.im, v.re);
 }
 
+//-------------------------------------------------------------------------------------------------
 real_t exp(real_t v) {
     return std::exp(v);
 }
 
-arr_cmplx exp(span_cmplx arr) {
-    arr_cmplx r(arr);
-    for (int i = 0; i < r.size(); ++i) {
-        const real_t v = std::exp(r[i].re);
-        r[i].re = v * std::cos(r[i].im);
-        r[i].im = v * std::sin(r[i].im);
-    }
-    return r;
-}
-
 cmplx_t exp(cmplx_t v) {
     return cmplx_t{std::exp(v.re) * std::cos(v.im), std::exp(v.re) * std::sin(v.im)};
 }
 
-arr_cmplx expj(span_real w) {
-    arr_cmplx r(w.size());
-    for (int i = 0; i < r.size(); ++i) {
-        r[i].re = std::cos(w[i]);
-        r[i].im = std::sin(w[i]);
-    }
-    return r;
-}
-
 cmplx_t expj(real_t w) {
     return cmplx_t{std::cos(w), std::sin(w)};
 }
 
 //-------------------------------------------------------------------------------------------------
-arr_real tanh(span_real x) {
-    arr_real r(x);
-    for (int i = 0; i < x.size(); ++i) {
-        r[i] = std::tanh(x[i]);
-    }
-    return r;
-}
-
 arr_cmplx tanh(span_cmplx x) {
     arr_cmplx r(x);
     for (int i = 0; i < x.size(); ++i) {
@@ -574,7 +608,7 @@ static base_array<T> _downsample(span_t<T> arr, int n, int phase) {
     }
 
     const int nr = (arr.size() - phase - 1) / n + 1;
-    base_array<T> r(nr);
+    base_array<T> r(nr, uninitialized);
     for (int i = 0, k = phase; k < arr.size(); ++i, k += n) {
         r[i] = arr[k];
     }
@@ -615,23 +649,27 @@ arr_cmplx upsample(span_cmplx arr, int n, int phase) {
 }
 
 //-------------------------------------------------------------------------------------------------
-arr_real abs2(const arr_cmplx& x) noexcept {
-    arr_real r(x.size());
-    for (int i = 0; i < x.size(); i++) {
-        r[i] = (x[i].re * x[i].re) + (x[i].im * x[i].im);
-    }
-    return r;
-}
-
-//-------------------------------------------------------------------------------------------------
-real_t norm(span_real x, int p) {
+template<typename T>
+static T _norm(span_t<T> x, int p) {
     if (p == 1) {
         return sum(abs(x));
     }
     if (p == 2) {
-        return sqrt(sum(abs2(x)));
+        return std::sqrt(dot(x, x));
     }
-    return power(sum(power(abs(x), p)), real_t(1) / p);
+    T s = 0;
+    for (int i = 0; i < x.size(); ++i) {
+        s += std::pow(std::fabs(x[i]), T(p));
+    }
+    return std::pow(s, T(1) / p);
+}
+
+float norm(span_f32 x, int p) {
+    return _norm(x, p);
+}
+
+double norm(span_f64 x, int p) {
+    return _norm(x, p);
 }
 
 real_t norm(span_cmplx x, int p) {
@@ -647,33 +685,56 @@ real_t norm(span_cmplx x, int p) {
 //-------------------------------------------------------------------------------------------------
 namespace {
 
+//the real type of the result: float/double for the real arrays, real_t for complex
 template<typename T>
-real_t _mse(span_t<T> x, span_t<T> y) {
+using real_type_t = decltype(_abs2(std::declval<T>()));
+
+template<typename T, typename R = real_type_t<T>>
+R _mse(span_t<T> x, span_t<T> y) {
     DSPLIB_ASSERT(x.size() == y.size(), "arrays sizes must be equal");
     const int n = x.size();
-    real_t s = 0;
-    for (int i = 0; i < n; ++i) {
-        s += abs2(x[i] - y[i]);
-    }
+    const R s = parallel_reduce<R>(
+      n,
+      [&](int i1, int i2) {
+          R s = 0;
+          for (int i = i1; i < i2; ++i) {
+              s += _abs2(x[i] - y[i]);
+          }
+          return s;
+      },
+      std::plus<>());
     return s / n;
 }
 
-template<typename T>
-real_t _nmse(span_t<T> x, span_t<T> y) {
+template<typename T, typename R = real_type_t<T>>
+R _nmse(span_t<T> x, span_t<T> y) {
     DSPLIB_ASSERT(x.size() == y.size(), "arrays sizes must be equal");
     const int n = x.size();
-    real_t s = 0;
-    real_t d = 0;
-    for (int i = 0; i < n; ++i) {
-        s += abs2(x[i] - y[i]);
-        d += abs2(x[i]);
-    }
+    using sums_t = std::pair<R, R>;
+    const auto [s, d] = parallel_reduce<sums_t>(
+      n,
+      [&](int i1, int i2) {
+          R s = 0;
+          R d = 0;
+          for (int i = i1; i < i2; ++i) {
+              s += _abs2(x[i] - y[i]);
+              d += _abs2(x[i]);
+          }
+          return sums_t{s, d};
+      },
+      [](const sums_t& a, const sums_t& b) {
+          return sums_t{a.first + b.first, a.second + b.second};
+      });
     return (s / n) / d;
 }
 
 }   // namespace
 
-real_t mse(span_real x, span_real y) {
+float mse(span_f32 x, span_f32 y) {
+    return _mse(x, y);
+}
+
+double mse(span_f64 x, span_f64 y) {
     return _mse(x, y);
 }
 
@@ -681,7 +742,11 @@ real_t mse(span_cmplx x, span_cmplx y) {
     return _mse(x, y);
 }
 
-real_t nmse(span_real x, span_real y) {
+float nmse(span_f32 x, span_f32 y) {
+    return _nmse(x, y);
+}
+
+double nmse(span_f64 x, span_f64 y) {
     return _nmse(x, y);
 }
 
@@ -690,9 +755,15 @@ real_t nmse(span_cmplx x, span_cmplx y) {
 }
 
 //-------------------------------------------------------------------------------------------------
-arr_real deg2rad(span_real x) {
-    auto y = arr_real(x);
-    y *= (pi / 180);
+arr_f32 deg2rad(span_f32 x) {
+    auto y = arr_f32(x);
+    y *= float(pi / 180);
+    return y;
+}
+
+arr_f64 deg2rad(span_f64 x) {
+    auto y = arr_f64(x);
+    y *= double(pi / 180);
     return y;
 }
 
@@ -700,9 +771,15 @@ real_t deg2rad(const real_t& x) {
     return x * (pi / 180);
 }
 
-arr_real rad2deg(span_real x) {
-    auto y = arr_real(x);
-    y *= (180 / pi);
+arr_f32 rad2deg(span_f32 x) {
+    auto y = arr_f32(x);
+    y *= float(180 / pi);
+    return y;
+}
+
+arr_f64 rad2deg(span_f64 x) {
+    auto y = arr_f64(x);
+    y *= double(180 / pi);
     return y;
 }
 
@@ -711,97 +788,63 @@ real_t rad2deg(const real_t& x) {
 }
 
 //-------------------------------------------------------------------------------------------------
-void pow2db(inplace_real arr) noexcept {
-    auto x = arr.get();
-    for (int i = 0; i < x.size(); ++i) {
-        x[i] = pow2db(x[i]);
-    }
-}
-
-void db2pow(inplace_real arr) noexcept {
-    auto x = arr.get();
-    for (int i = 0; i < x.size(); ++i) {
-        x[i] = db2pow(x[i]);
-    }
-}
-
 real_t pow2db(real_t v) noexcept {
     return 10 * std::log10(v);
 }
 
-arr_real pow2db(span_real arr) noexcept {
-    arr_real r(arr);
-    pow2db(inplace(r));
-    return r;
-}
-
 real_t db2pow(real_t v) noexcept {
     return std::pow(real_t(10), (v / 10));
 }
 
-arr_real db2pow(span_real arr) noexcept {
-    arr_real r(arr);
-    db2pow(inplace(r));
-    return r;
-}
-
 //-------------------------------------------------------------------------------------------------
-void mag2db(inplace_real arr) noexcept {
-    auto x = arr.get();
-    for (int i = 0; i < x.size(); ++i) {
-        x[i] = mag2db(x[i]);
-    }
-}
-
-void db2mag(inplace_real arr) noexcept {
-    auto x = arr.get();
-    for (int i = 0; i < x.size(); ++i) {
-        x[i] = db2mag(x[i]);
-    }
-}
-
 real_t mag2db(real_t v) noexcept {
     return 20 * std::log10(v);
 }
 
-arr_real mag2db(span_real arr) noexcept {
-    arr_real r(arr);
-    mag2db(inplace(r));
-    return r;
-}
-
 real_t db2mag(real_t v) noexcept {
     return std::pow(real_t(10), (v / 20));
 }
 
-arr_real db2mag(span_real arr) noexcept {
-    arr_real r(arr);
-    db2mag(inplace(r));
-    return r;
-}
-
 //-------------------------------------------------------------------------------------------------
 template<class T, class Fn>
 static bool _exists(span_t<T> x, Fn pred) {
     return std::find_if(x.begin(), x.end(), pred) != x.end();
 }
 
-bool anynan(span_real x) {
-    return _exists(x, [](const real_t& v) {
+template<typename T>
+static bool _anynan(span_t<T> x) {
+    return _exists(x, [](const T& v) {
         return std::isnan(v);
     });
 }
 
+template<typename T>
+static bool _anyinf(span_t<T> x) {
+    return _exists(x, [](const T& v) {
+        return std::isinf(v);
+    });
+}
+
+bool anynan(span_f32 x) {
+    return _anynan(x);
+}
+
+bool anynan(span_f64 x) {
+    return _anynan(x);
+}
+
 bool anynan(span_cmplx x) {
     return _exists(x, [](const cmplx_t& v) {
         return std::isnan(v.re) || std::isnan(v.im);
     });
 }
 
-bool anyinf(span_real x) {
-    return _exists(x, [](const real_t& v) {
-        return std::isinf(v);
-    });
+bool anyinf(span_f32 x) {
+    return _anyinf(x);
+}
+
+bool anyinf(span_f64 x) {
+    return _anyinf(x);
 }
 
 bool anyinf(span_cmplx x) {
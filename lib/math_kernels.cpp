@@ -15,77 +15,367 @@
 #define DSPLIB_NO_TYPES_FP_CONSTANTS
 
 #include "dsplib/math.h"
+#include "dsplib/split.h"
+
+#include "internal/dispatch.h"
+#include "internal/parallel.h"
 
 namespace dsplib {
 
-//-------------------------------------------------------------------------------------------------
-real_t sum(span_real arr) {
-    const size_t n = arr.size();
-    real_t sum{0};
-    for (size_t i = 0; i < n; ++i) {
-        sum += arr[i];
+//The kernels are dispatched by the CPU features (see internal/dispatch.h), so they must be plain loops
+//without calls of non-inline functions. The large arrays are split into blocks by parallel_reduce/parallel_for
+//(see internal/parallel.h).
+
+namespace {
+
+//number of independent partial sums of the reductions
+//The lanes break the dependency chain of the accumulator, so the loops are vectorized without reassociation
+//(DSPLIB_SAFE_MATH=ON). The lanes are combined in the fixed order.
+constexpr int REDUCE_LANES = 8;
+
+//((a0 + a4) + (a2 + a6)) + ((a1 + a5) + (a3 + a7)), `stride` = 2 for the interleaved re/im lanes
+template<typename T>
+T _reduce_lanes(const T* acc, int stride = 1) noexcept {
+    T r[REDUCE_LANES];
+    const int m = REDUCE_LANES / stride;
+    for (int k = 0; k < m; ++k) {
+        r[k] = acc[k * stride];
     }
-    return sum;
+    for (int h = m / 2; h > 0; h /= 2) {
+        for (int k = 0; k < h; ++k) {
+            r[k] += r[k + h];
+        }
+    }
+    return r[0];
 }
 
-cmplx_t sum(span_cmplx arr) {
-    const size_t n = arr.size();
-    real_t sum_re{0};
-    real_t sum_im{0};
-    for (size_t i = 0; i < n; ++i) {
-        sum_re += arr[i].re;
-        sum_im += arr[i].im;
+template<typename T>
+struct SumKernel
+{
+    static T run(const T* restrict x, int n) noexcept {
+        T acc[REDUCE_LANES] = {};
+        int i = 0;
+        for (; i + REDUCE_LANES <= n; i += REDUCE_LANES) {
+            for (int k = 0; k < REDUCE_LANES; ++k) {
+                acc[k] += x[i + k];
+            }
+        }
+        for (; i < n; ++i) {
+            acc[i % REDUCE_LANES] += x[i];
+        }
+        return _reduce_lanes(acc);
+    }
+};
+
+//interleaved complex as real pairs, the even lanes are re, the odd lanes are im
+struct SumCmplxKernel
+{
+    static cmplx_t run(const real_t* restrict x, int n) noexcept {
+        real_t acc[REDUCE_LANES] = {};
+        const int m = 2 * n;
+        int i = 0;
+        for (; i + REDUCE_LANES <= m; i += REDUCE_LANES) {
+            for (int k = 0; k < REDUCE_LANES; ++k) {
+                acc[k] += x[i + k];
+            }
+        }
+        for (; i < m; ++i) {
+            acc[i % REDUCE_LANES] += x[i];
+        }
+        return {_reduce_lanes(acc, 2), _reduce_lanes(acc + 1, 2)};
+    }
+};
+
+template<typename T>
+struct DotKernel
+{
+    static T run(const T* restrict x1, const T* restrict x2, int n) noexcept {
+        T acc[REDUCE_LANES] = {};
+        int i = 0;
+        for (; i + REDUCE_LANES <= n; i += REDUCE_LANES) {
+            for (int k = 0; k < REDUCE_LANES; ++k) {
+                acc[k] += x1[i + k] * x2[i + k];
+            }
+        }
+        for (; i < n; ++i) {
+            acc[i % REDUCE_LANES] += x1[i] * x2[i];
+        }
+        return _reduce_lanes(acc);
+    }
+};
+
+//re = sum(ar * br) - sum(ai * bi), im = sum(ar * bi) + sum(ai * br), the lanes are the real pairs
+struct DotCmplxKernel
+{
+    static cmplx_t run(const real_t* restrict x1, const real_t* restrict x2, int n) noexcept {
+        //even lanes: ar * br, ar * bi; odd lanes: ai * bi, ai * br
+        real_t acc1[REDUCE_LANES] = {};
+        real_t acc2[REDUCE_LANES] = {};
+        const int m = 2 * n;
+        int i = 0;
+        for (; i + REDUCE_LANES <= m; i += REDUCE_LANES) {
+            for (int k = 0; k < REDUCE_LANES; k += 2) {
+                acc1[k] += x1[i + k] * x2[i + k];
+                acc1[k + 1] += x1[i + k + 1] * x2[i + k + 1];
+                acc2[k] += x1[i + k] * x2[i + k + 1];
+                acc2[k + 1] += x1[i + k + 1] * x2[i + k];
+            }
+        }
+        for (; i < m; i += 2) {
+            const int k = i % REDUCE_LANES;
+            acc1[k] += x1[i] * x2[i];
+            acc1[k + 1] += x1[i + 1] * x2[i + 1];
+            acc2[k] += x1[i] * x2[i + 1];
+            acc2[k + 1] += x1[i + 1] * x2[i];
+        }
+        const real_t re = _reduce_lanes(acc1, 2) - _reduce_lanes(acc1 + 1, 2);
+        const real_t im = _reduce_lanes(acc2, 2) + _reduce_lanes(acc2 + 1, 2);
+        return {re, im};
+    }
+};
+
+//sum(x.^2), `n` real values
+template<typename T>
+struct SumSquaresKernel
+{
+    static T run(const T* restrict x, int n) noexcept {
+        T acc[REDUCE_LANES] = {};
+        int i = 0;
+        for (; i + REDUCE_LANES <= n; i += REDUCE_LANES) {
+            for (int k = 0; k < REDUCE_LANES; ++k) {
+                acc[k] += x[i + k] * x[i + k];
+            }
+        }
+        for (; i < n; ++i) {
+            acc[i % REDUCE_LANES] += x[i] * x[i];
+        }
+        return _reduce_lanes(acc);
+    }
+};
+
+struct DeinterleaveKernel
+{
+    static void run(const real_t* restrict x, real_t* restrict re, real_t* restrict im, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            re[i] = x[2 * i];
+            im[i] = x[2 * i + 1];
+        }
+    }
+};
+
+struct InterleaveKernel
+{
+    static void run(const real_t* restrict re, const real_t* restrict im, real_t* restrict r, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            r[2 * i] = re[i];
+            r[2 * i + 1] = im[i];
+        }
     }
-    return {sum_re, sum_im};
+};
+
+struct DotSplitKernel
+{
+    static cmplx_t run(const real_t* restrict ar, const real_t* restrict ai, const real_t* restrict br,
+                       const real_t* restrict bi, int n) noexcept {
+        real_t acc_re[REDUCE_LANES] = {};
+        real_t acc_im[REDUCE_LANES] = {};
+        int i = 0;
+        for (; i + REDUCE_LANES <= n; i += REDUCE_LANES) {
+            for (int k = 0; k < REDUCE_LANES; ++k) {
+                acc_re[k] += ar[i + k] * br[i + k] - ai[i + k] * bi[i + k];
+                acc_im[k] += ar[i + k] * bi[i + k] + ai[i + k] * br[i + k];
+            }
+        }
+        for (; i < n; ++i) {
+            acc_re[i % REDUCE_LANES] += ar[i] * br[i] - ai[i] * bi[i];
+            acc_im[i % REDUCE_LANES] += ar[i] * bi[i] + ai[i] * br[i];
+        }
+        return {_reduce_lanes(acc_re), _reduce_lanes(acc_im)};
+    }
+};
+
+//interleaved complex input
+struct Abs2Kernel
+{
+    static void run(const real_t* restrict x, real_t* restrict r, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            r[i] = x[2 * i] * x[2 * i] + x[2 * i + 1] * x[2 * i + 1];
+        }
+    }
+};
+
+struct Abs2SplitKernel
+{
+    static void run(const real_t* restrict re, const real_t* restrict im, real_t* restrict r, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            r[i] = re[i] * re[i] + im[i] * im[i];
+        }
+    }
+};
+
+//without restrict: the output can be equal to one of the inputs
+struct MultiplySplitKernel
+{
+    static void run(const real_t* ar, const real_t* ai, const real_t* br, const real_t* bi, real_t* rr, real_t* ri,
+                    real_t s, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            const real_t vr = ar[i];
+            const real_t vi = ai[i];
+            const real_t wr = br[i];
+            const real_t wi = s * bi[i];
+            rr[i] = vr * wr - vi * wi;
+            ri[i] = vr * wi + vi * wr;
+        }
+    }
+};
+
+const real_t* _as_real(const cmplx_t* x) noexcept {
+    static_assert(sizeof(cmplx_t) == 2 * sizeof(real_t), "cmplx_t must be a pair of real_t");
+    return reinterpret_cast<const real_t*>(x);
+}
+
+real_t* _as_real(cmplx_t* x) noexcept {
+    return reinterpret_cast<real_t*>(x);
+}
+
+template<typename T>
+T _sum(const T* x, int n) {
+    return parallel_reduce<T>(
+      n,
+      [x](int i1, int i2) {
+          return dispatch<SumKernel<T>>(x + i1, i2 - i1);
+      },
+      std::plus<>());
+}
+
+template<typename T>
+T _dot(const T* x1, const T* x2, int n) {
+    return parallel_reduce<T>(
+      n,
+      [x1, x2](int i1, int i2) {
+          return dispatch<DotKernel<T>>(x1 + i1, x2 + i1, i2 - i1);
+      },
+      std::plus<>());
+}
+
+//sum(x.^2), `n` real values
+template<typename T>
+T _sum_squares(const T* x, int n) {
+    return parallel_reduce<T>(
+      n,
+      [x](int i1, int i2) {
+          return dispatch<SumSquaresKernel<T>>(x + i1, i2 - i1);
+      },
+      std::plus<>());
+}
+
+template<typename T>
+T _rms(const T* x, int n, int nv) {
+    DSPLIB_ASSUME(nv > 1);
+    const T sum = _sum_squares(x, n);
+    return std::sqrt(sum / (nv - 1));
+}
+
+}   // namespace
+
+//-------------------------------------------------------------------------------------------------
+float sum(span_f32 arr) {
+    return _sum(arr.data(), arr.size());
+}
+
+double sum(span_f64 arr) {
+    return _sum(arr.data(), arr.size());
+}
+
+cmplx_t sum(span_cmplx arr) {
+    const real_t* x = _as_real(arr.data());
+    return parallel_reduce<cmplx_t>(
+      arr.size(),
+      [x](int i1, int i2) {
+          return dispatch<SumCmplxKernel>(x + 2 * i1, i2 - i1);
+      },
+      std::plus<>());
 }
 
 //-------------------------------------------------------------------------------------------------
-real_t dot(span_real x1, span_real x2) {
+float dot(span_f32 x1, span_f32 x2) {
     DSPLIB_ASSERT(x1.size() == x2.size(), "arrays sizes must be equal");
-    const size_t n = x1.size();
-    real_t acc = 0;
-    for (size_t i = 0; i < n; ++i) {
-        acc += x1[i] * x2[i];
-    }
-    return acc;
+    return _dot(x1.data(), x2.data(), x1.size());
+}
+
+double dot(span_f64 x1, span_f64 x2) {
+    DSPLIB_ASSERT(x1.size() == x2.size(), "arrays sizes must be equal");
+    return _dot(x1.data(), x2.data(), x1.size());
 }
 
 cmplx_t dot(span_cmplx x1, span_cmplx x2) {
     DSPLIB_ASSERT(x1.size() == x2.size(), "arrays sizes must be equal");
-    const size_t n = x1.size();
-    real_t acc_re{0};
-    real_t acc_im{0};
-    for (size_t i = 0; i < n; ++i) {
-        const real_t ar = x1[i].re;
-        const real_t ai = x1[i].im;
-        const real_t br = x2[i].re;
-        const real_t bi = x2[i].im;
-        acc_re += ar * br - ai * bi;
-        acc_im += ar * bi + ai * br;
-    }
-    return {acc_re, acc_im};
+    const real_t* a = _as_real(x1.data());
+    const real_t* b = _as_real(x2.data());
+    return parallel_reduce<cmplx_t>(
+      x1.size(),
+      [a, b](int i1, int i2) {
+          return dispatch<DotCmplxKernel>(a + 2 * i1, b + 2 * i1, i2 - i1);
+      },
+      std::plus<>());
 }
 
 //-------------------------------------------------------------------------------------------------
-real_t rms(span_real arr) {
-    const size_t n = arr.size();
-    DSPLIB_ASSUME(n > 1);
-    real_t sum = 0;
-    for (size_t i = 0; i < n; ++i) {
-        sum += (arr[i] * arr[i]);
-    }
-    return std::sqrt(sum / (n - 1));
+float rms(span_f32 arr) {
+    return _rms(arr.data(), arr.size(), arr.size());
+}
+
+double rms(span_f64 arr) {
+    return _rms(arr.data(), arr.size(), arr.size());
 }
 
 real_t rms(span_cmplx arr) {
-    const size_t n = arr.size();
-    DSPLIB_ASSUME(n > 1);
-    real_t sum = 0;
-    for (size_t i = 0; i < n; ++i) {
-        sum += (arr[i].re * arr[i].re);
-        sum += (arr[i].im * arr[i].im);
-    }
-    return std::sqrt(sum / (n - 1));
+    return _rms(_as_real(arr.data()), 2 * arr.size(), arr.size());
+}
+
+//-------------------------------------------------------------------------------------------------
+arr_real abs2(const arr_cmplx& x) noexcept {
+    arr_real r(x.size(), uninitialized);
+    abs2(x, r);
+    return r;
+}
+
+void abs2(span_cmplx x, mut_span_real r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    const real_t* px = _as_real(x.data());
+    real_t* pr = r.data();
+    parallel_for(x.size(), [px, pr](int i1, int i2) {
+        dispatch<Abs2Kernel>(px + 2 * i1, pr + i1, i2 - i1);
+    });
+}
+
+//-------------------------------------------------------------------------------------------------
+//split-complex kernels
+void deinterleave(span_cmplx x, mut_span_cmplx_split r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    dispatch<DeinterleaveKernel>(_as_real(x.data()), r.re().data(), r.im().data(), x.size());
+}
+
+void interleave(span_cmplx_split x, mut_span_cmplx r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    dispatch<InterleaveKernel>(x.re().data(), x.im().data(), _as_real(r.data()), x.size());
+}
+
+cmplx_t dot(span_cmplx_split x1, span_cmplx_split x2) {
+    DSPLIB_ASSERT(x1.size() == x2.size(), "arrays sizes must be equal");
+    return dispatch<DotSplitKernel>(x1.re().data(), x1.im().data(), x2.re().data(), x2.im().data(), x1.size());
+}
+
+void abs2(span_cmplx_split x, mut_span_real r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    dispatch<Abs2SplitKernel>(x.re().data(), x.im().data(), r.data(), x.size());
+}
+
+void multiply(span_cmplx_split x1, span_cmplx_split x2, mut_span_cmplx_split r, bool conj2) {
+    DSPLIB_ASSERT((x1.size() == x2.size()) && (x1.size() == r.size()), "arrays sizes must be equal");
+    const real_t s = conj2 ? -1 : 1;
+    dispatch<MultiplySplitKernel>(x1.re().data(), x1.im().data(), x2.re().data(), x2.im().data(), r.re().data(),
+                                  r.im().data(), s, x1.size());
 }
 
-}   // namespace dsplib
\ No newline at end of file
+}   // namespace dsplib
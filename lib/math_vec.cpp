@@ -0,0 +1,709 @@
+// Vectorized elementary functions for the array overloads.
+//
+// The kernels are branch-free polynomial approximations written as plain loops, so they are auto-vectorized
+// and dispatched by the CPU features (see internal/dispatch.h), the large arrays are split into the blocks of the
+// thread pool (see internal/parallel.h). All evaluations are done in double (float arrays are converted in the
+// loop). The special values (NaN, Inf, zero, negative log argument) are handled by selects, so this file must
+// not be compiled with the unsafe floating-point optimizations (only -fno-trapping-math and -fno-math-errno are
+// used, they allow to vectorize the selects and sqrt).
+
+#include "dsplib/math.h"
+#include "dsplib/assert.h"
+
+#include "internal/dispatch.h"
+#include "internal/parallel.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace dsplib {
+
+namespace {
+
+std::atomic<MathAccuracy> g_math_accuracy{MathAccuracy::Precise};
+
+inline uint64_t _bits(double x) noexcept {
+    uint64_t u;
+    std::memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+inline double _from_bits(uint64_t u) noexcept {
+    double x;
+    std::memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+constexpr double NAN_ = std::numeric_limits<double>::quiet_NaN();
+
+//`x + SHIFTER - SHIFTER` rounds x to integer (|x| < 2^51), the low bits of `x + SHIFTER` contain this integer
+constexpr double SHIFTER = 6755399441055744.0;   //1.5 * 2^52
+
+constexpr double LOG2E = 1.44269504088896338700e+00;
+constexpr double LN10 = 2.30258509299404568402;
+constexpr double LN2_HI = 6.93147180369123816490e-01;
+constexpr double LN2_LO = 1.90821492927058770002e-10;
+
+//pi/2 = PIO2_1 + PIO2_2 + PIO2_3, the parts have 33 bits, so `k * PIO2_n` is exact for |k| < 2^20
+constexpr double TWO_OVER_PI = 6.36619772367581382433e-01;
+constexpr double PIO2_1 = 1.57079632673412561417e+00;
+constexpr double PIO2_2 = 6.07710050630396597660e-11;
+constexpr double PIO2_3 = 2.02226624871116645580e-21;
+
+//the reduction is accurate for |x| <= 2^19, the larger arguments are recomputed by std::sin/std::cos
+constexpr double SINCOS_MAX = 524288.0;
+
+//pi/4, pi/2, pi as the sum of the nearest double and the residual
+constexpr double PIO4_HI = 7.85398163397448278999e-01;
+constexpr double PIO4_LO = 3.06161699786838301793e-17;
+constexpr double PIO2_HI = 1.57079632679489655800e+00;
+constexpr double PIO2_LO = 6.12323399573676603587e-17;
+constexpr double PI_HI = 3.14159265358979311600e+00;
+constexpr double PI_LO = 1.22464679914735320717e-16;
+
+//-------------------------------------------------------------------------------------------------
+//exp(x) = 2^k * exp(r), x = k * ln2 + r, |r| <= ln2/2
+//Precise: Taylor polynomial of degree 13 (truncation error < 1e-17)
+//Fast: degree 7 (relative error < 6e-9)
+template<bool Fast>
+inline double _exp(double x) noexcept {
+    //NaN is clamped too (the comparison is false), it is restored at the end
+    double xc = (x < 710.0) ? x : 710.0;
+    xc = (xc > -746.0) ? xc : -746.0;
+
+    const double kd = xc * LOG2E + SHIFTER;
+    const double k = kd - SHIFTER;
+    const double r = (xc - k * LN2_HI) - k * LN2_LO;
+
+    double p;
+    if constexpr (Fast) {
+        p = 1.0 / 5040;
+        p = p * r + 1.0 / 720;
+        p = p * r + 1.0 / 120;
+        p = p * r + 1.0 / 24;
+        p = p * r + 1.0 / 6;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+    } else {
+        p = 1.0 / 6227020800;
+        p = p * r + 1.0 / 479001600;
+        p = p * r + 1.0 / 39916800;
+        p = p * r + 1.0 / 3628800;
+        p = p * r + 1.0 / 362880;
+        p = p * r + 1.0 / 40320;
+        p = p * r + 1.0 / 5040;
+        p = p * r + 1.0 / 720;
+        p = p * r + 1.0 / 120;
+        p = p * r + 1.0 / 24;
+        p = p * r + 1.0 / 6;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+    }
+
+    //2^k in two steps: k is in [-1077, 1025], the result can be subnormal or overflow
+    //(only the unsigned 64-bit add/shift are used, they are available in all SIMD levels)
+    const double k1 = (k * 0.5 + SHIFTER) - SHIFTER;
+    const double k2 = k - k1;
+    const double s1 = _from_bits((_bits(k1 + SHIFTER) - _bits(SHIFTER) + 1023) << 52);
+    const double s2 = _from_bits((_bits(k2 + SHIFTER) - _bits(SHIFTER) + 1023) << 52);
+    const double y = (p * s1) * s2;
+    return (x != x) ? x : y;
+}
+
+//log(x) = e * ln2 + log(m), x = 2^e * m, m in [sqrt(2)/2, sqrt(2))
+//log(m) = log(1 + f) = f - s * (f - T), s = f / (2 + f), T = 2s^2/3 + 2s^4/5 + ...
+//Precise: series up to s^21 (truncation error < 1e-18)
+//Fast: up to s^9 (absolute error < 1e-9)
+template<bool Fast>
+inline double _log(double x) noexcept {
+    //subnormal input is normalized by 2^54
+    const bool sub = (x < 2.2250738585072014e-308);
+    const double xs = sub ? (x * 18014398509481984.0) : x;
+    const uint64_t u = _bits(xs);
+
+    double m = _from_bits((u & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+    const bool hi = (m > 1.4142135623730951);
+    m = hi ? (m * 0.5) : m;
+
+    //exponent as double without the int->double conversion
+    const double eb = _from_bits(((u >> 52) & 0x7ff) | 0x4330000000000000ULL) - 4503599627370496.0;
+    const double e = eb - 1023.0 + (hi ? 1.0 : 0.0) - (sub ? 54.0 : 0.0);
+
+    const double f = m - 1.0;
+    const double s = f / (2.0 + f);
+    const double z = s * s;
+    double t;
+    if constexpr (Fast) {
+        t = 2.0 / 9;
+        t = t * z + 2.0 / 7;
+        t = t * z + 2.0 / 5;
+        t = t * z + 2.0 / 3;
+    } else {
+        t = 2.0 / 21;
+        t = t * z + 2.0 / 19;
+        t = t * z + 2.0 / 17;
+        t = t * z + 2.0 / 15;
+        t = t * z + 2.0 / 13;
+        t = t * z + 2.0 / 11;
+        t = t * z + 2.0 / 9;
+        t = t * z + 2.0 / 7;
+        t = t * z + 2.0 / 5;
+        t = t * z + 2.0 / 3;
+    }
+    t = t * z;
+
+    const double logm = f - s * (f - t);
+    double y = e * LN2_HI + (logm + e * LN2_LO);
+
+    y = (x == 0) ? -INF : y;
+    y = (x < 0) ? NAN_ : y;
+    y = (x == INF) ? INF : y;
+    return (x != x) ? x : y;
+}
+
+//sin(x) and cos(x) by the reduction to [-pi/4, pi/4] and the quadrant
+//Precise: minimax polynomials (fdlibm __kernel_sin/__kernel_cos)
+//Fast: Taylor polynomials of degree 9/10 (absolute error < 2e-9)
+template<bool Fast>
+inline void _sincos(double x, double& vsin, double& vcos) noexcept {
+    const double kd = x * TWO_OVER_PI + SHIFTER;
+    const double k = kd - SHIFTER;
+    const double r = ((x - k * PIO2_1) - k * PIO2_2) - k * PIO2_3;
+    const uint64_t q = _bits(kd) & 3;
+    const double z = r * r;
+
+    double ps;
+    double pc;
+    if constexpr (Fast) {
+        ps = 1.0 / 362880;
+        ps = ps * z - 1.0 / 5040;
+        ps = ps * z + 1.0 / 120;
+        ps = ps * z - 1.0 / 6;
+        pc = -1.0 / 3628800;
+        pc = pc * z + 1.0 / 40320;
+        pc = pc * z - 1.0 / 720;
+        pc = pc * z + 1.0 / 24;
+    } else {
+        ps = 1.58969099521155010221e-10;
+        ps = ps * z - 2.50507602534068634195e-08;
+        ps = ps * z + 2.75573137070700676789e-06;
+        ps = ps * z - 1.98412698298579493134e-04;
+        ps = ps * z + 8.33333333332248946124e-03;
+        ps = ps * z - 1.66666666666666324348e-01;
+        pc = -1.13596475577881948265e-11;
+        pc = pc * z + 2.08757232129817482790e-09;
+        pc = pc * z - 2.75573143513906633035e-07;
+        pc = pc * z + 2.48015872894767294178e-05;
+        pc = pc * z - 1.38888888888741095749e-03;
+        pc = pc * z + 4.16666666666666019037e-02;
+    }
+    const double sr = r + r * z * ps;
+    const double cr = (1.0 - 0.5 * z) + z * z * pc;
+
+    const bool swap = (q & 1) != 0;
+    const double s = swap ? cr : sr;
+    const double c = swap ? sr : cr;
+    vsin = (q == 2 || q == 3) ? -s : s;
+    vcos = (q == 1 || q == 2) ? -c : c;
+}
+
+//tanh(x) = x + x^3 * P(x^2) / Q(x^2) for |x| < 0.625 (Cephes), 1 - 2 / (exp(2|x|) + 1) otherwise
+template<bool Fast>
+inline double _tanh(double x) noexcept {
+    const double a = (x < 0) ? -x : x;
+    const double z = x * x;
+    double p = -9.64399179425052238628e-1;
+    p = p * z - 9.92877231001918586564e1;
+    p = p * z - 1.61468768441708447952e3;
+    double q = z + 1.12811678491632931402e2;
+    q = q * z + 2.23548839060100448583e3;
+    q = q * z + 4.84406305325125486048e3;
+    const double ys = x + x * z * (p / q);
+
+    const double yl = 1.0 - 2.0 / (_exp<Fast>(2.0 * a) + 1.0);
+    const double y = (x < 0) ? -yl : yl;
+    return (a < 0.625) ? ys : y;
+}
+
+//atan2(y, x) by the reduction to atan(t), |t| <= 0.66: a = min(|x|,|y|) / max(|x|,|y|) in [0, 1],
+//a > 0.66: atan(a) = pi/4 + atan((a - 1) / (a + 1)), then the octant by the signs and |y| > |x|
+//Precise: atan(t) = t + t^3 * P(t^2) / Q(t^2) (Cephes)
+//Fast: Taylor polynomial of degree 17 on |t| <= tan(pi/8) (relative error < 1e-8)
+template<bool Fast>
+inline double _atan2(double y, double x) noexcept {
+    constexpr double TH = Fast ? 0.41421356237309503 : 0.66;
+    const double ax = std::fabs(x);
+    const double ay = std::fabs(y);
+    const double mx = (ax > ay) ? ax : ay;
+    const double mn = (ax > ay) ? ay : ax;
+
+    //(a - 1) / (a + 1) = (mn - mx) / (mn + mx), one division for both branches
+    //0/0 gives atan = 0, inf/inf gives pi/4
+    const bool hi = (mn > TH * mx) || (mn == INF);
+    double t = hi ? ((mn - mx) / (mn + mx)) : (mn / mx);
+    t = (mn == mx) ? 0.0 : t;
+    const double z = t * t;
+
+    double r;
+    if constexpr (Fast) {
+        double p = 1.0 / 17;
+        p = p * z - 1.0 / 15;
+        p = p * z + 1.0 / 13;
+        p = p * z - 1.0 / 11;
+        p = p * z + 1.0 / 9;
+        p = p * z - 1.0 / 7;
+        p = p * z + 1.0 / 5;
+        p = p * z - 1.0 / 3;
+        r = t + t * z * p;
+    } else {
+        double p = -8.750608600031904122785e-01;
+        p = p * z - 1.615753718733365076637e+01;
+        p = p * z - 7.500855792314704667340e+01;
+        p = p * z - 1.228866684490136173410e+02;
+        p = p * z - 6.485021904942025371773e+01;
+        double q = z + 2.485846490142306297962e+01;
+        q = q * z + 1.650270098316988542046e+02;
+        q = q * z + 4.328810604912902668951e+02;
+        q = q * z + 4.853903996359136964868e+02;
+        q = q * z + 1.945506571482613964425e+02;
+        r = t + t * z * (p / q);
+    }
+    r = hi ? (PIO4_HI + (r + PIO4_LO)) : r;
+
+    r = (ay > ax) ? ((PIO2_HI - r) + PIO2_LO) : r;
+    r = (std::copysign(1.0, x) < 0) ? ((PI_HI - r) + PI_LO) : r;
+    r = std::copysign(r, y);
+    return (x != x || y != y) ? (x + y) : r;
+}
+
+//-------------------------------------------------------------------------------------------------
+//kernels: y[i] = scale * fn(x[i] * xscale), the input and output can be the same memory
+template<typename T, bool Fast>
+struct ExpKernel
+{
+    static void run(const T* x, T* y, double xscale, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            y[i] = T(_exp<Fast>(double(x[i]) * xscale));
+        }
+    }
+};
+
+template<typename T, bool Fast>
+struct LogKernel
+{
+    static void run(const T* x, T* y, double scale, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            y[i] = T(_log<Fast>(double(x[i])) * scale);
+        }
+    }
+};
+
+template<typename T, bool Fast>
+struct TanhKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            y[i] = T(_tanh<Fast>(double(x[i])));
+        }
+    }
+};
+
+template<typename T, bool Fast>
+struct SinKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            double s;
+            double c;
+            _sincos<Fast>(double(x[i]), s, c);
+            y[i] = T(s);
+        }
+    }
+};
+
+template<typename T, bool Fast>
+struct CosKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            double s;
+            double c;
+            _sincos<Fast>(double(x[i]), s, c);
+            y[i] = T(c);
+        }
+    }
+};
+
+//interleaved complex output: y = (cos(x), sin(x))
+template<typename T, bool Fast>
+struct ExpjKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            double s;
+            double c;
+            _sincos<Fast>(double(x[i]), s, c);
+            y[2 * i] = T(c);
+            y[2 * i + 1] = T(s);
+        }
+    }
+};
+
+//interleaved complex: y = exp(re) * (cos(im), sin(im))
+template<typename T, bool Fast>
+struct ExpCmplxKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            const double v = _exp<Fast>(double(x[2 * i]));
+            double s;
+            double c;
+            _sincos<Fast>(double(x[2 * i + 1]), s, c);
+            y[2 * i] = T(v * c);
+            y[2 * i + 1] = T(v * s);
+        }
+    }
+};
+
+//complex kernels: interleaved input, real outputs
+template<typename T, bool>
+struct AbsKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            const double re = x[2 * i];
+            const double im = x[2 * i + 1];
+            y[i] = T(std::sqrt(re * re + im * im));
+        }
+    }
+};
+
+template<typename T, bool Fast>
+struct AngleKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            y[i] = T(_atan2<Fast>(double(x[2 * i + 1]), double(x[2 * i])));
+        }
+    }
+};
+
+template<typename T, bool Fast>
+struct MagPhaseKernel
+{
+    static void run(const T* x, T* mag, T* phase, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            const double re = x[2 * i];
+            const double im = x[2 * i + 1];
+            mag[i] = T(std::sqrt(re * re + im * im));
+            phase[i] = T(_atan2<Fast>(im, re));
+        }
+    }
+};
+
+//y = 10 * log10(re^2 + im^2)
+template<typename T, bool Fast>
+struct Abs2DbKernel
+{
+    static void run(const T* x, T* y, int n) noexcept {
+        for (int i = 0; i < n; ++i) {
+            const double re = x[2 * i];
+            const double im = x[2 * i + 1];
+            y[i] = T(_log<Fast>(re * re + im * im) * (10 / LN10));
+        }
+    }
+};
+
+//pointer to the interleaved complex data (the block offset is doubled)
+template<typename T>
+struct Interleaved
+{
+    T* ptr;
+};
+
+template<typename T>
+T* _offset(T* x, int i) noexcept {
+    return x + i;
+}
+
+template<typename T>
+T* _offset(Interleaved<T> x, int i) noexcept {
+    return x.ptr + 2 * i;
+}
+
+inline double _offset(double v, int) noexcept {
+    return v;
+}
+
+//Kernel<T>::run(args..., n) by the blocks of the thread pool (see internal/parallel.h)
+template<template<typename, bool> class Kernel, typename T = real_t, typename... Args>
+void _run(int n, Args... args) {
+    const bool fast = (math_accuracy() == MathAccuracy::Fast);
+    parallel_for(n, [=](int i1, int i2) {
+        if (fast) {
+            dispatch<Kernel<T, true>>(_offset(args, i1)..., i2 - i1);
+        } else {
+            dispatch<Kernel<T, false>>(_offset(args, i1)..., i2 - i1);
+        }
+    });
+}
+
+template<typename T>
+bool _sincos_in_range(T x) noexcept {
+    return std::abs(x) <= SINCOS_MAX;
+}
+
+Interleaved<real_t> _interleaved(cmplx_t* x) noexcept {
+    return {reinterpret_cast<real_t*>(x)};
+}
+
+Interleaved<const real_t> _interleaved(const cmplx_t* x) noexcept {
+    return {reinterpret_cast<const real_t*>(x)};
+}
+
+}   // namespace
+
+//-------------------------------------------------------------------------------------------------
+void set_math_accuracy(MathAccuracy accuracy) noexcept {
+    g_math_accuracy.store(accuracy, std::memory_order_relaxed);
+}
+
+MathAccuracy math_accuracy() noexcept {
+    return g_math_accuracy.load(std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------------------------------
+//real arrays of both precisions, y = scale * fn(x * xscale)
+template<template<typename, bool> class Kernel, typename T>
+static base_array<T> _apply(span_t<T> x, double scale) {
+    base_array<T> r(x.size(), uninitialized);
+    _run<Kernel, T>(x.size(), x.data(), r.data(), scale);
+    return r;
+}
+
+template<template<typename, bool> class Kernel, typename T>
+static void _apply_inplace(mut_span_t<T> x, double scale) {
+    _run<Kernel, T>(x.size(), x.data(), x.data(), scale);
+}
+
+arr_f32 exp(span_f32 arr) {
+    return _apply<ExpKernel>(arr, 1.0);
+}
+
+arr_f64 exp(span_f64 arr) {
+    return _apply<ExpKernel>(arr, 1.0);
+}
+
+arr_cmplx exp(span_cmplx arr) {
+    const int n = arr.size();
+    arr_cmplx r(n, uninitialized);
+    _run<ExpCmplxKernel>(n, _interleaved(arr.data()), _interleaved(r.data()));
+    parallel_for(n, [&](int i1, int i2) {
+        for (int i = i1; i < i2; ++i) {
+            if (!_sincos_in_range(arr[i].im)) {
+                r[i] = exp(arr[i]);
+            }
+        }
+    });
+    return r;
+}
+
+arr_cmplx expj(span_real w) {
+    const int n = w.size();
+    arr_cmplx r(n, uninitialized);
+    _run<ExpjKernel>(n, w.data(), _interleaved(r.data()));
+    parallel_for(n, [&](int i1, int i2) {
+        for (int i = i1; i < i2; ++i) {
+            if (!_sincos_in_range(w[i])) {
+                r[i] = expj(w[i]);
+            }
+        }
+    });
+    return r;
+}
+
+template<typename T, bool Cos>
+static base_array<T> _sin_or_cos(span_t<T> arr) {
+    const int n = arr.size();
+    base_array<T> r(n, uninitialized);
+    if constexpr (Cos) {
+        _run<CosKernel, T>(n, arr.data(), r.data());
+    } else {
+        _run<SinKernel, T>(n, arr.data(), r.data());
+    }
+    parallel_for(n, [&](int i1, int i2) {
+        for (int i = i1; i < i2; ++i) {
+            if (!_sincos_in_range(arr[i])) {
+                r[i] = Cos ? std::cos(arr[i]) : std::sin(arr[i]);
+            }
+        }
+    });
+    return r;
+}
+
+arr_f32 sin(span_f32 arr) {
+    return _sin_or_cos<float, false>(arr);
+}
+
+arr_f64 sin(span_f64 arr) {
+    return _sin_or_cos<double, false>(arr);
+}
+
+arr_f32 cos(span_f32 arr) {
+    return _sin_or_cos<float, true>(arr);
+}
+
+arr_f64 cos(span_f64 arr) {
+    return _sin_or_cos<double, true>(arr);
+}
+
+template<typename T>
+static base_array<T> _tanh_array(span_t<T> x) {
+    base_array<T> r(x.size(), uninitialized);
+    _run<TanhKernel, T>(x.size(), x.data(), r.data());
+    return r;
+}
+
+arr_f32 tanh(span_f32 x) {
+    return _tanh_array(x);
+}
+
+arr_f64 tanh(span_f64 x) {
+    return _tanh_array(x);
+}
+
+//-------------------------------------------------------------------------------------------------
+arr_f32 log(span_f32 arr) {
+    return _apply<LogKernel>(arr, 1.0);
+}
+
+arr_f64 log(span_f64 arr) {
+    return _apply<LogKernel>(arr, 1.0);
+}
+
+arr_f32 log2(span_f32 arr) {
+    return _apply<LogKernel>(arr, LOG2E);
+}
+
+arr_f64 log2(span_f64 arr) {
+    return _apply<LogKernel>(arr, LOG2E);
+}
+
+arr_f32 log10(span_f32 arr) {
+    return _apply<LogKernel>(arr, 1 / LN10);
+}
+
+arr_f64 log10(span_f64 arr) {
+    return _apply<LogKernel>(arr, 1 / LN10);
+}
+
+//-------------------------------------------------------------------------------------------------
+void pow2db(inplace_f32 arr) noexcept {
+    _apply_inplace<LogKernel>(arr.get(), 10 / LN10);
+}
+
+void pow2db(inplace_f64 arr) noexcept {
+    _apply_inplace<LogKernel>(arr.get(), 10 / LN10);
+}
+
+void db2pow(inplace_f32 arr) noexcept {
+    _apply_inplace<ExpKernel>(arr.get(), LN10 / 10);
+}
+
+void db2pow(inplace_f64 arr) noexcept {
+    _apply_inplace<ExpKernel>(arr.get(), LN10 / 10);
+}
+
+arr_f32 pow2db(span_f32 arr) noexcept {
+    return _apply<LogKernel>(arr, 10 / LN10);
+}
+
+arr_f64 pow2db(span_f64 arr) noexcept {
+    return _apply<LogKernel>(arr, 10 / LN10);
+}
+
+arr_f32 db2pow(span_f32 arr) noexcept {
+    return _apply<ExpKernel>(arr, LN10 / 10);
+}
+
+arr_f64 db2pow(span_f64 arr) noexcept {
+    return _apply<ExpKernel>(arr, LN10 / 10);
+}
+
+void mag2db(inplace_f32 arr) noexcept {
+    _apply_inplace<LogKernel>(arr.get(), 20 / LN10);
+}
+
+void mag2db(inplace_f64 arr) noexcept {
+    _apply_inplace<LogKernel>(arr.get(), 20 / LN10);
+}
+
+void db2mag(inplace_f32 arr) noexcept {
+    _apply_inplace<ExpKernel>(arr.get(), LN10 / 20);
+}
+
+void db2mag(inplace_f64 arr) noexcept {
+    _apply_inplace<ExpKernel>(arr.get(), LN10 / 20);
+}
+
+arr_f32 mag2db(span_f32 arr) noexcept {
+    return _apply<LogKernel>(arr, 20 / LN10);
+}
+
+arr_f64 mag2db(span_f64 arr) noexcept {
+    return _apply<LogKernel>(arr, 20 / LN10);
+}
+
+arr_f32 db2mag(span_f32 arr) noexcept {
+    return _apply<ExpKernel>(arr, LN10 / 20);
+}
+
+arr_f64 db2mag(span_f64 arr) noexcept {
+    return _apply<ExpKernel>(arr, LN10 / 20);
+}
+
+//-------------------------------------------------------------------------------------------------
+arr_real abs(span_cmplx arr) noexcept {
+    arr_real r(arr.size(), uninitialized);
+    abs(arr, r);
+    return r;
+}
+
+void abs(span_cmplx x, mut_span_real r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    _run<AbsKernel>(x.size(), _interleaved(x.data()), r.data());
+}
+
+arr_real angle(span_cmplx arr) {
+    arr_real r(arr.size(), uninitialized);
+    angle(arr, r);
+    return r;
+}
+
+void angle(span_cmplx x, mut_span_real r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    _run<AngleKernel>(x.size(), _interleaved(x.data()), r.data());
+}
+
+void magphase(span_cmplx x, mut_span_real mag, mut_span_real phase) {
+    DSPLIB_ASSERT((x.size() == mag.size()) && (x.size() == phase.size()), "arrays sizes must be equal");
+    _run<MagPhaseKernel>(x.size(), _interleaved(x.data()), mag.data(), phase.data());
+}
+
+arr_real abs2db(span_cmplx x) noexcept {
+    arr_real r(x.size(), uninitialized);
+    _run<Abs2DbKernel>(x.size(), _interleaved(x.data()), r.data());
+    return r;
+}
+
+void abs2db(span_cmplx x, mut_span_real r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    _run<Abs2DbKernel>(x.size(), _interleaved(x.data()), r.data());
+}
+
+}   // namespace dsplib
@@ -3,8 +3,11 @@
 #include "dsplib/array.h"
 #include "dsplib/fft.h"
 #include "dsplib/math.h"
+#include "dsplib/expr.h"
 #include "dsplib/window.h"
 
+#include "internal/scratch.h"
+
 namespace dsplib {
 
 namespace {
@@ -18,32 +21,34 @@ arr_real _mscohere(const arr_real& x, const arr_real& y, const arr_real& win, in
     const int stride = winlen - noverlap;
     const int num_segments = (N - winlen) / stride + 1;
 
-    arr_real Pxx(nfft / 2 + 1);
-    arr_real Pyy(nfft / 2 + 1);
-    arr_cmplx Pxy(nfft / 2 + 1);
-    arr_cmplx X(nfft / 2 + 1);
-    arr_cmplx Y(nfft / 2 + 1);
-    arr_real px(winlen);
-    arr_real py(winlen);
+    const int nh = nfft / 2 + 1;
+    const int nseg = std::min(winlen, nfft);
+    const auto plan = fft_plan_r(nfft);
+    ScratchScope scratch;
+    auto Pxx = scratch.zeros<real_t>(nh);
+    auto Pyy = scratch.zeros<real_t>(nh);
+    auto Pxy = scratch.zeros<cmplx_t>(nh);
+    auto X = scratch.alloc<cmplx_t>(nfft);
+    auto Y = scratch.alloc<cmplx_t>(nfft);
+    auto px = scratch.zeros<real_t>(nfft);
+    auto py = scratch.zeros<real_t>(nfft);
 
     for (int i = 0; i < num_segments; ++i) {
         int t1 = (i * stride);
-        int t2 = t1 + winlen;
+        int t2 = t1 + nseg;
 
-        px.slice(0, winlen) = x.slice(t1, t2);
-        px *= win;
-        X = fft(px, nfft).slice(0, nfft / 2 + 1);
-        Pxx += abs2(X);
+        px.slice(0, nseg) = lazy(x.slice(t1, t2)) * lazy(win.slice(0, nseg));
+        plan->solve(px, X);
+        Pxx += abs2(lazy(X.slice(0, nh)));
 
-        py.slice(0, winlen) = y.slice(t1, t2);
-        py *= win;
-        Y = fft(py, nfft).slice(0, nfft / 2 + 1);
-        Pyy += abs2(Y);
+        py.slice(0, nseg) = lazy(y.slice(t1, t2)) * lazy(win.slice(0, nseg));
+        plan->solve(py, Y);
+        Pyy += abs2(lazy(Y.slice(0, nh)));
 
-        Pxy += X * conj(Y);
+        Pxy += lazy(X.slice(0, nh)) * conj(lazy(Y.slice(0, nh)));
     }
 
-    return abs2(Pxy) / (Pxx * Pyy);
+    return eval(abs2(lazy(Pxy)) / (lazy(Pxx) * lazy(Pyy)));
 }
 
 int _nextfft(int n) noexcept {
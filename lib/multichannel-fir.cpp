@@ -0,0 +1,160 @@
+#include "dsplib/fir.h"
+
+#include <cstring>
+
+namespace dsplib {
+
+namespace {
+
+//y[i * nc + c] = sum(x[(i + k) * nc + c] * h[k]), where `h` is already flipped and conjugated
+template<typename T>
+void _mc_conv(const T* restrict x, const T* restrict h, T* restrict y, int nh, int ny, int nc) noexcept {
+    for (int i = 0; i < ny; ++i) {
+        T* restrict py = y + (i * nc);
+        for (int c = 0; c < nc; ++c) {
+            py[c] = 0;
+        }
+        const T* restrict px = x + (i * nc);
+        for (int k = 0; k < nh; ++k) {
+            const T hk = h[k];
+            for (int c = 0; c < nc; ++c) {
+                py[c] += px[c] * hk;
+            }
+            px += nc;
+        }
+    }
+}
+
+}   // namespace
+
+template<typename T>
+class MultiChannelFirImpl
+{
+public:
+    explicit MultiChannelFirImpl(std::shared_ptr<const base_array<T>> h, int num_channels)
+      : nc_{num_channels}
+      , h_{std::move(h)} {
+        DSPLIB_ASSERT(h_ != nullptr && !h_->empty(), "impulse response must not be empty");
+        DSPLIB_ASSERT(num_channels > 0, "number of channels must be positive");
+        const int nh = h_->size();
+        hr_ = base_array<T>(nh);
+        for (int k = 0; k < nh; ++k) {
+            hr_[k] = conj((*h_)[nh - k - 1]);
+        }
+        nd_ = (nh - 1) * nc_;
+        buf_.resize(nd_);
+    }
+
+    //x and y can be the same memory
+    void process(span_t<T> x, mut_span_t<T> y) {
+        DSPLIB_ASSERT(x.size() % nc_ == 0, "input size must be a multiple of the number of channels");
+        DSPLIB_ASSERT(x.size() == y.size(), "output size must be equal to input size");
+        const int nx = x.size();
+        if (nx == 0) {
+            return;
+        }
+
+        //buffer: [delay | input]
+        buf_.resize(nd_ + nx);
+        std::memcpy(buf_.data() + nd_, x.data(), nx * sizeof(T));
+        if (x.data() != y.data()) {
+            _mc_conv(buf_.data(), hr_.data(), y.data(), hr_.size(), nx / nc_, nc_);
+        } else {
+            out_.resize(nx);
+            _mc_conv(buf_.data(), hr_.data(), out_.data(), hr_.size(), nx / nc_, nc_);
+            std::memcpy(y.data(), out_.data(), nx * sizeof(T));
+        }
+        std::memmove(buf_.data(), buf_.data() + nx, nd_ * sizeof(T));
+    }
+
+    std::vector<base_array<T>> process(const std::vector<base_array<T>>& x) {
+        DSPLIB_ASSERT(int(x.size()) == nc_, "number of input channels mismatch");
+        const int n = x[0].size();
+        for (const auto& ch : x) {
+            DSPLIB_ASSERT(ch.size() == n, "all channels must have the same size");
+        }
+
+        //planar -> interleaved
+        inter_.resize(n * nc_);
+        for (int c = 0; c < nc_; ++c) {
+            const T* px = x[c].data();
+            for (int i = 0; i < n; ++i) {
+                inter_[i * nc_ + c] = px[i];
+            }
+        }
+
+        this->process(make_span(inter_), make_span(inter_));
+
+        //interleaved -> planar
+        std::vector<base_array<T>> r(nc_, base_array<T>(n));
+        for (int c = 0; c < nc_; ++c) {
+            T* pr = r[c].data();
+            for (int i = 0; i < n; ++i) {
+                pr[i] = inter_[i * nc_ + c];
+            }
+        }
+        return r;
+    }
+
+    [[nodiscard]] int num_channels() const noexcept {
+        return nc_;
+    }
+
+    [[nodiscard]] span_t<T> coeffs() const noexcept {
+        return make_span(*h_);
+    }
+
+private:
+    const int nc_;
+    int nd_{0};
+    std::shared_ptr<const base_array<T>> h_;
+    base_array<T> hr_;      ///< flipped and conjugated impulse response
+    std::vector<T> buf_;    ///< interleaved delay line + input frame
+    std::vector<T> out_;    ///< temporary output for inplace processing
+    std::vector<T> inter_;  ///< interleaved planar input
+};
+
+//-------------------------------------------------------------------------------------------------
+template<typename T>
+MultiChannelFir<T>::MultiChannelFir(span_t<T> h, int num_channels)
+  : MultiChannelFir(std::make_shared<const base_array<T>>(h), num_channels) {
+}
+
+template<typename T>
+MultiChannelFir<T>::MultiChannelFir(std::shared_ptr<const base_array<T>> h, int num_channels)
+  : d_{std::make_shared<MultiChannelFirImpl<T>>(std::move(h), num_channels)} {
+}
+
+template<typename T>
+base_array<T> MultiChannelFir<T>::process(span_t<T> x) {
+    base_array<T> r(x.size());
+    d_->process(x, make_span(r));
+    return r;
+}
+
+template<typename T>
+void MultiChannelFir<T>::process(inplace_span_t<T> x) {
+    auto s = x.get();
+    d_->process(s, s);
+}
+
+template<typename T>
+std::vector<base_array<T>> MultiChannelFir<T>::process(const std::vector<base_array<T>>& x) {
+    return d_->process(x);
+}
+
+template<typename T>
+int MultiChannelFir<T>::num_channels() const noexcept {
+    return d_->num_channels();
+}
+
+template<typename T>
+span_t<T> MultiChannelFir<T>::coeffs() const noexcept {
+    return d_->coeffs();
+}
+
+template class MultiChannelFir<float>;
+template class MultiChannelFir<double>;
+template class MultiChannelFir<cmplx_t>;
+
+}   // namespace dsplib
@@ -0,0 +1,188 @@
+#include "dsplib/parallel.h"
+#include "dsplib/assert.h"
+
+#include "internal/parallel.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef DSPLIB_PARALLEL
+#include <condition_variable>
+#include <thread>
+#endif
+
+namespace dsplib {
+
+namespace {
+
+std::atomic<int> g_num_threads{1};
+std::atomic<int> g_parallel_threshold{1 << 20};
+
+#ifdef DSPLIB_PARALLEL
+
+//workers wait for the job, the tasks are taken by the atomic counter
+class ThreadPool
+{
+public:
+    explicit ThreadPool(int nworkers) {
+        for (int i = 0; i < nworkers; ++i) {
+            workers_.emplace_back([this]() {
+                _loop();
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (auto& w : workers_) {
+            w.join();
+        }
+    }
+
+    //false if the pool is busy by another call
+    bool try_run(int ntasks, const std::function<void(int)>& fn) {
+        std::unique_lock<std::mutex> busy(busy_, std::try_to_lock);
+        if (!busy.owns_lock()) {
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            job_ = &fn;
+            ntasks_ = ntasks;
+            next_.store(0);
+            active_ = int(workers_.size());
+            ++generation_;
+        }
+        start_.notify_all();
+
+        //the workers refer to `fn`, wait for them even if `fn` throws in the calling thread
+        struct WaitGuard
+        {
+            ThreadPool* pool;
+            ~WaitGuard() {
+                std::unique_lock<std::mutex> lk(pool->mutex_);
+                pool->done_.wait(lk, [this]() {
+                    return pool->active_ == 0;
+                });
+                pool->job_ = nullptr;
+            }
+        } guard{this};
+
+        _work(fn, ntasks);
+        return true;
+    }
+
+private:
+    void _loop() {
+        uint64_t seen = 0;
+        while (true) {
+            const std::function<void(int)>* job = nullptr;
+            int ntasks = 0;
+            {
+                std::unique_lock<std::mutex> lk(mutex_);
+                start_.wait(lk, [&]() {
+                    return stop_ || (generation_ != seen);
+                });
+                if (stop_) {
+                    return;
+                }
+                seen = generation_;
+                job = job_;
+                ntasks = ntasks_;
+            }
+
+            _work(*job, ntasks);
+
+            std::lock_guard<std::mutex> lk(mutex_);
+            if (--active_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+    void _work(const std::function<void(int)>& fn, int ntasks) {
+        for (int i = next_.fetch_add(1); i < ntasks; i = next_.fetch_add(1)) {
+            fn(i);
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex busy_;
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    const std::function<void(int)>* job_{nullptr};
+    int ntasks_{0};
+    std::atomic<int> next_{0};
+    int active_{0};
+    uint64_t generation_{0};
+    bool stop_{false};
+};
+
+std::mutex g_pool_mutex;
+std::shared_ptr<ThreadPool> g_pool;
+
+std::shared_ptr<ThreadPool> _pool() {
+    std::lock_guard<std::mutex> lk(g_pool_mutex);
+    return g_pool;
+}
+
+#endif
+
+}   // namespace
+
+void set_num_threads(int n) {
+    DSPLIB_ASSERT(n >= 0, "number of threads must be non-negative");
+#ifdef DSPLIB_PARALLEL
+    if (n == 0) {
+        n = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+    std::lock_guard<std::mutex> lk(g_pool_mutex);
+    if (n != g_num_threads.load()) {
+        //the running calls keep the old pool until the end
+        g_pool = (n > 1) ? std::make_shared<ThreadPool>(n - 1) : nullptr;
+        g_num_threads.store(n);
+    }
+#endif
+}
+
+int num_threads() noexcept {
+    return g_num_threads.load(std::memory_order_relaxed);
+}
+
+void set_parallel_threshold(int n) {
+    DSPLIB_ASSERT(n > 0, "parallel threshold must be positive");
+    g_parallel_threshold.store(n, std::memory_order_relaxed);
+}
+
+int parallel_threshold() noexcept {
+    return g_parallel_threshold.load(std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------------------------------
+//does not depend on the number of threads: the same partition (and rounding) for any num_threads()
+bool use_parallel(int n) noexcept {
+    return (n >= parallel_threshold()) && (n > PARALLEL_BLOCK);
+}
+
+void parallel_run(int ntasks, const std::function<void(int)>& fn) {
+#ifdef DSPLIB_PARALLEL
+    const auto pool = _pool();
+    if (pool && pool->try_run(ntasks, fn)) {
+        return;
+    }
+#endif
+    for (int i = 0; i < ntasks; ++i) {
+        fn(i);
+    }
+}
+
+}   // namespace dsplib
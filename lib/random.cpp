@@ -39,7 +39,7 @@ arr_int randi(std::array<int, 2> range, int n) {
     const int imin = range[0];
     const int imax = range[1];
     std::uniform_int_distribution<int> dist(imin, imax);
-    arr_int r(n);
+    arr_int r(n, uninitialized);
     for (int i = 0; i < n; ++i) {
         r[i] = dist(g_engine);
     }
@@ -48,7 +48,7 @@ arr_int randi(std::array<int, 2> range, int n) {
 
 //-------------------------------------------------------------------------------------------------
 arr_real rand(int n) {
-    arr_real r(n);
+    arr_real r(n, uninitialized);
     std::uniform_real_distribution<real_t> dist{0, 1};
     for (int i = 0; i < n; ++i) {
         r[i] = dist(g_engine);
@@ -64,7 +64,7 @@ real_t rand() {
 
 //-------------------------------------------------------------------------------------------------
 arr_real rand(std::array<real_t, 2> range, int n) {
-    arr_real r(n);
+    arr_real r(n, uninitialized);
     std::uniform_real_distribution<real_t> dist{range[0], range[1]};
     for (int i = 0; i < n; ++i) {
         r[i] = dist(g_engine);
@@ -74,7 +74,7 @@ arr_real rand(std::array<real_t, 2> range, int n) {
 
 //-------------------------------------------------------------------------------------------------
 arr_real randn(int n) {
-    arr_real r(n);
+    arr_real r(n, uninitialized);
     std::normal_distribution<real_t> dist{0, 1};
     for (int i = 0; i < n; ++i) {
         r[i] = dist(g_engine);
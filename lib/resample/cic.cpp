@@ -0,0 +1,223 @@
+#include "dsplib/resample.h"
+#include "dsplib/window.h"
+#include "dsplib/ifft.h"
+
+#include <cmath>
+#include <type_traits>
+
+namespace dsplib {
+
+namespace {
+
+constexpr int CIC_MAX_GROWTH = 54;
+constexpr int CIC_MAX_FRAC_BITS = 48;
+
+//number of real lanes in the sample (complex input is processed as IQ pairs)
+template<typename T>
+constexpr int _lanes = std::is_same_v<T, cmplx_t> ? 2 : 1;
+
+//real lane type: float/double, real_t for complex
+template<typename T>
+using _lane_t = std::conditional_t<std::is_same_v<T, cmplx_t>, real_t, T>;
+
+//fractional bits of the input, the output register must fit in 63 bits
+int _cic_qbits(int rate, int order, int diff_delay) {
+    DSPLIB_ASSERT(rate > 0, "CIC rate must be positive");
+    DSPLIB_ASSERT(order > 0, "CIC order must be positive");
+    DSPLIB_ASSERT(diff_delay > 0, "CIC differential delay must be positive");
+    const int growth = int(std::ceil(order * std::log2(real_t(rate) * diff_delay)));
+    DSPLIB_ASSERT(growth <= CIC_MAX_GROWTH, "CIC register growth exceeds 54 bits");
+    return std::min(CIC_MAX_FRAC_BITS, 62 - growth);
+}
+
+//the wraparound is well defined for the unsigned type
+uint64_t _quantize(real_t x, real_t scale) noexcept {
+    return uint64_t(std::llround(x * scale));
+}
+
+real_t _dequantize(uint64_t v, real_t scale) noexcept {
+    return real_t(int64_t(v)) * scale;
+}
+
+//magnitude response of the CIC filter, f - normalized to the high rate
+real_t _cic_response(real_t f, int rate, int order, int diff_delay) {
+    const int rm = rate * diff_delay;
+    if (std::abs(f) < 1e-12) {
+        return 1;
+    }
+    return std::pow(std::abs(std::sin(pi * rm * f) / (rm * std::sin(pi * f))), order);
+}
+
+}   // namespace
+
+//------------------------------------------------------------------------------
+template<typename T>
+BaseCICDecimator<T>::BaseCICDecimator(int decim, int order, int diff_delay)
+  : decim_{decim}
+  , order_{order}
+  , ddelay_{diff_delay}
+  , qbits_{_cic_qbits(decim, order, diff_delay)} {
+    constexpr int L = _lanes<T>;
+    qscale_ = std::ldexp(real_t(1), qbits_);
+    oscale_ = 1 / (qscale_ * std::pow(real_t(decim_) * ddelay_, order_));
+    integ_.assign(order_ * L, 0);
+    comb_.assign(order_ * ddelay_ * L, 0);
+}
+
+template<typename T>
+base_array<T> BaseCICDecimator<T>::process(span_t<T> in) {
+    base_array<T> y(in.size() / decim_, uninitialized);
+    this->process(in, make_span(y));
+    return y;
+}
+
+template<typename T>
+void BaseCICDecimator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(in.size() % decim_ == 0, "input frame length must be a multiple of the 'decim'");
+    DSPLIB_ASSERT(out.size() == in.size() / decim_, "output frame length must be equal in.size() / decim");
+    constexpr int L = _lanes<T>;
+    const auto* px = reinterpret_cast<const _lane_t<T>*>(in.data());
+    auto* py = reinterpret_cast<_lane_t<T>*>(out.data());
+    uint64_t* integ = integ_.data();
+    const int ny = out.size();
+    for (int i = 0; i < ny; ++i) {
+        //integrators at the high rate
+        for (int r = 0; r < decim_; ++r, px += L) {
+            for (int l = 0; l < L; ++l) {
+                uint64_t v = _quantize(px[l], qscale_);
+                for (int k = 0; k < order_; ++k) {
+                    integ[k * L + l] += v;
+                    v = integ[k * L + l];
+                }
+            }
+        }
+
+        //combs at the low rate
+        for (int l = 0; l < L; ++l) {
+            uint64_t v = integ[(order_ - 1) * L + l];
+            for (int k = 0; k < order_; ++k) {
+                uint64_t& d = comb_[(k * ddelay_ + cpos_) * L + l];
+                const uint64_t t = v - d;
+                d = v;
+                v = t;
+            }
+            py[i * L + l] = _dequantize(v, oscale_);
+        }
+        cpos_ = (cpos_ + 1) % ddelay_;
+    }
+}
+
+template<typename T>
+int BaseCICDecimator<T>::delay() const noexcept {
+    return int(std::lround(real_t(order_) * (decim_ * ddelay_ - 1) / (2 * decim_)));
+}
+
+template<typename T>
+int BaseCICDecimator<T>::decim_rate() const noexcept {
+    return decim_;
+}
+
+template class BaseCICDecimator<float>;
+template class BaseCICDecimator<double>;
+template class BaseCICDecimator<cmplx_t>;
+
+//------------------------------------------------------------------------------
+template<typename T>
+BaseCICInterpolator<T>::BaseCICInterpolator(int interp, int order, int diff_delay)
+  : interp_{interp}
+  , order_{order}
+  , ddelay_{diff_delay}
+  , qbits_{_cic_qbits(interp, order, diff_delay)} {
+    constexpr int L = _lanes<T>;
+    qscale_ = std::ldexp(real_t(1), qbits_);
+    oscale_ = interp_ / (qscale_ * std::pow(real_t(interp_) * ddelay_, order_));
+    integ_.assign(order_ * L, 0);
+    comb_.assign(order_ * ddelay_ * L, 0);
+}
+
+template<typename T>
+base_array<T> BaseCICInterpolator<T>::process(span_t<T> in) {
+    base_array<T> y(in.size() * interp_, uninitialized);
+    this->process(in, make_span(y));
+    return y;
+}
+
+template<typename T>
+void BaseCICInterpolator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(out.size() == in.size() * interp_, "output frame length must be equal in.size() * interp");
+    constexpr int L = _lanes<T>;
+    const auto* px = reinterpret_cast<const _lane_t<T>*>(in.data());
+    auto* py = reinterpret_cast<_lane_t<T>*>(out.data());
+    uint64_t* integ = integ_.data();
+    const int nx = in.size();
+    for (int i = 0; i < nx; ++i, px += L) {
+        //combs at the low rate
+        uint64_t c[L];
+        for (int l = 0; l < L; ++l) {
+            uint64_t v = _quantize(px[l], qscale_);
+            for (int k = 0; k < order_; ++k) {
+                uint64_t& d = comb_[(k * ddelay_ + cpos_) * L + l];
+                const uint64_t t = v - d;
+                d = v;
+                v = t;
+            }
+            c[l] = v;
+        }
+        cpos_ = (cpos_ + 1) % ddelay_;
+
+        //zero insertion and integrators at the high rate
+        for (int r = 0; r < interp_; ++r, py += L) {
+            for (int l = 0; l < L; ++l) {
+                uint64_t v = (r == 0) ? c[l] : 0;
+                for (int k = 0; k < order_; ++k) {
+                    integ[k * L + l] += v;
+                    v = integ[k * L + l];
+                }
+                py[l] = _dequantize(v, oscale_);
+            }
+        }
+    }
+}
+
+template<typename T>
+int BaseCICInterpolator<T>::delay() const noexcept {
+    return int(std::lround(real_t(order_) * (interp_ * ddelay_ - 1) / 2));
+}
+
+template<typename T>
+int BaseCICInterpolator<T>::interp_rate() const noexcept {
+    return interp_;
+}
+
+template class BaseCICInterpolator<float>;
+template class BaseCICInterpolator<double>;
+template class BaseCICInterpolator<cmplx_t>;
+
+//------------------------------------------------------------------------------
+arr_real design_cic_compensator(int rate, int order, int diff_delay, int ntaps, real_t wn) {
+    DSPLIB_ASSERT(ntaps > 0, "number of taps must be positive");
+    DSPLIB_ASSERT((wn > 0) && (wn < 1), "cutoff frequency must be in range (0, 1)");
+
+    //linear phase frequency response on a dense grid, inverse CIC response in the passband
+    const int nfft = int(1) << nextpow2(8 * ntaps);
+    const int nh = nfft / 2 + 1;
+    const real_t shift = real_t(ntaps - 1) / 2;
+    arr_cmplx hf(nh);
+    for (int k = 0; k < nh; ++k) {
+        const real_t f = real_t(k) / (nh - 1);
+        if (f > wn) {
+            break;
+        }
+        const real_t g = _cic_response(f / (2 * rate), rate, order, diff_delay);
+        const real_t a = 1 / std::max(g, real_t(1e-3));
+        hf[k] = a * expj(-2 * pi * k * shift / nfft);
+    }
+
+    const auto h = irfft(hf, nfft);
+    arr_real r = h.slice(0, ntaps);
+    r *= window::hamming(ntaps);
+    r /= sum(r);
+    return r;
+}
+
+}   // namespace dsplib
@@ -1,45 +1,44 @@
 #include "dsplib/resample.h"
 
+#include "resample/polyphase-kernels.h"
+#include "resample/polyphase-history.h"
+#include "resample/polyphase-tables.h"
+
 namespace dsplib {
 
 namespace {
 
-class Decimator : public IResampler
+template<typename T>
+class Decimator : public BaseResampler<T>
 {
 public:
-    explicit Decimator(int decim, span_real h)
+    explicit Decimator(int decim, std::shared_ptr<const PolyphaseTable> table)
       : decim_{decim}
-      , h_{polyphase(h, decim_, 1.0, false)}
-      , flen_{h_[0].size()}   //TODO: flen can be const for typical `design_multirate_fir`
-      , d_(decim_ * (flen_ - 1)) {
+      , tab_{std::move(table)} {
+        flen_ = tab_->sublen;   //TODO: flen can be const for typical `design_multirate_fir`
+        nd_ = decim_ * (flen_ - 1);
+        d_ = base_array<T>(polyphase_buffer_size(nd_, decim_));
+        acc_ = base_array<T>(decim_);
     }
 
-    arr_real process(span_real in) final {
-        const int nx = in.size();
-        const int nd = d_.size();
-        const int ny = nx / decim_;
-
-        DSPLIB_ASSERT(nx % decim_ == 0, "input frame length must be a multiple of the 'decim'");
-
-        arr_real x(nd + nx);
-        std::memcpy(x.data(), d_.data(), nd * sizeof(real_t));
-        std::memcpy(x.data() + nd, in.data(), nx * sizeof(real_t));
-        std::memcpy(d_.data(), x.data() + nx, nd * sizeof(real_t));
-
-        arr_real y(ny);
-        if (decim_ == 2) {
-            _decimate_d2(x.data(), y.data(), ny);
-        } else if (decim_ == 3) {
-            _decimate_d3(x.data(), y.data(), ny);
-        } else if (decim_ == 4) {
-            _decimate_d4(x.data(), y.data(), ny);
-        } else {
-            _decimate(x.data(), y.data(), ny);
-        }
-
+    base_array<T> process(span_t<T> in) final {
+        base_array<T> y(this->output_size(in.size()), uninitialized);
+        this->process(in, make_span(y));
         return y;
     }
 
+    void process(span_t<T> in, mut_span_t<T> out) final {
+        DSPLIB_ASSERT(out.size() == this->output_size(in.size()), "output frame length must be equal output_size()");
+        T* py = out.data();
+        polyphase_stream(make_span(d_), make_span(acc_), nacc_, nd_, decim_, in, [&](const T* x, int i, int n) {
+            polyphase_decimate(x, tab_->taps<T>(), py + i, n, decim_, tab_->h.size());
+        });
+    }
+
+    [[nodiscard]] int output_size(int size) const noexcept final {
+        return (nacc_ + size) / decim_;
+    }
+
     [[nodiscard]] int delay() const noexcept final {
         return flen_ / 2;
     }
@@ -49,96 +48,59 @@ public:
     }
 
 private:
-    //TODO: enable unsafe math
-    void _decimate(const real_t* restrict x, real_t* restrict y, int ny) noexcept {
-        for (int i = 0; i < ny; ++i) {
-            const real_t* restrict px = x + (decim_ * i);
-            real_t acc = 0;
-            for (int j = 0; j < flen_; ++j) {
-                for (int k = 0; k < decim_; ++k) {
-                    acc += px[k] * h_[k][j];
-                }
-                px += decim_;
-            }
-            y[i] = acc;
-        }
-    }
-
-    //it can be 2-3x faster
-    void _decimate_d2(const real_t* restrict x, real_t* restrict y, int ny) noexcept {
-        constexpr int D = 2;
-        const real_t* restrict h0 = h_[0].data();
-        const real_t* restrict h1 = h_[1].data();
-        for (int i = 0; i < ny; ++i) {
-            const real_t* restrict px = x + (D * i);
-            real_t acc = 0;
-            for (int j = 0; j < flen_; ++j) {
-                acc += px[0] * h0[j] + px[1] * h1[j];
-                px += D;
-            }
-            y[i] = acc;
-        }
-    }
-
-    void _decimate_d3(const real_t* restrict x, real_t* restrict y, int ny) noexcept {
-        constexpr int D = 3;
-        const real_t* restrict h0 = h_[0].data();
-        const real_t* restrict h1 = h_[1].data();
-        const real_t* restrict h2 = h_[2].data();
-        for (int i = 0; i < ny; ++i) {
-            const real_t* restrict px = x + (D * i);
-            real_t acc = 0;
-            for (int j = 0; j < flen_; ++j) {
-                acc += px[0] * h0[j] + px[1] * h1[j] + px[2] * h2[j];
-                px += D;
-            }
-            y[i] = acc;
-        }
-    }
-
-    void _decimate_d4(const real_t* restrict x, real_t* restrict y, int ny) noexcept {
-        constexpr int D = 4;
-        const real_t* restrict h0 = h_[0].data();
-        const real_t* restrict h1 = h_[1].data();
-        const real_t* restrict h2 = h_[2].data();
-        const real_t* restrict h3 = h_[3].data();
-        for (int i = 0; i < ny; ++i) {
-            const real_t* restrict px = x + (D * i);
-            real_t acc = 0;
-            for (int j = 0; j < flen_; ++j) {
-                acc += px[0] * h0[j] + px[1] * h1[j] + px[2] * h2[j] + px[3] * h3[j];
-                px += D;
-            }
-            y[i] = acc;
-        }
-    }
-
     const int decim_;
-    std::vector<arr_real> h_;
-    const int flen_;
-    arr_real d_;
+    int flen_;
+    int nd_;
+    std::shared_ptr<const PolyphaseTable> tab_;   ///< interleaved branches, h[j * decim + k]
+    base_array<T> d_;
+    base_array<T> acc_;
+    int nacc_{0};
 };
 
 }   // namespace
 
-FIRDecimator::FIRDecimator(int decim)
-  : FIRDecimator(decim, design_multirate_fir(1, decim)) {
+template<typename T>
+BaseFIRDecimator<T>::BaseFIRDecimator(int decim)
+  : BaseFIRDecimator(decim, shared_multirate_fir(1, decim)) {
+}
+
+template<typename T>
+BaseFIRDecimator<T>::BaseFIRDecimator(int decim, span_real h) {
+    d_ = std::make_shared<Decimator<T>>(decim, std::make_shared<const PolyphaseTable>(decimator_table(decim, h)));
 }
 
-FIRDecimator::FIRDecimator(int decim, span_real h) {
-    d_ = std::make_shared<Decimator>(decim, h);
+template<typename T>
+BaseFIRDecimator<T>::BaseFIRDecimator(int decim, std::shared_ptr<const arr_real> h) {
+    d_ = std::make_shared<Decimator<T>>(decim, shared_polyphase_table(PolyphaseLayout::Decimator, 1, decim, h));
 }
 
-arr_real FIRDecimator::process(span_real in) {
+template<typename T>
+base_array<T> BaseFIRDecimator<T>::process(span_t<T> in) {
     return d_->process(in);
 }
 
-[[nodiscard]] int FIRDecimator::delay() const noexcept {
+template<typename T>
+void BaseFIRDecimator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    d_->process(in, out);
+}
+
+template<typename T>
+int BaseFIRDecimator<T>::output_size(int size) const noexcept {
+    return d_->output_size(size);
+}
+
+template<typename T>
+[[nodiscard]] int BaseFIRDecimator<T>::delay() const noexcept {
     return d_->delay();
 }
 
-[[nodiscard]] int FIRDecimator::decim_rate() const noexcept {
+template<typename T>
+[[nodiscard]] int BaseFIRDecimator<T>::decim_rate() const noexcept {
     return d_->decim_rate();
 }
 
+template class BaseFIRDecimator<float>;
+template class BaseFIRDecimator<double>;
+template class BaseFIRDecimator<cmplx_t>;
+
 }   // namespace dsplib
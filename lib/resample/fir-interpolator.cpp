@@ -1,47 +1,63 @@
 #include "dsplib/array.h"
 #include "dsplib/resample.h"
 
+#include "resample/polyphase-kernels.h"
+#include "resample/polyphase-history.h"
+#include "resample/polyphase-tables.h"
+
 namespace dsplib {
 
-FIRInterpolator::FIRInterpolator(int interp)
-  : FIRInterpolator{interp, design_multirate_fir(interp, 1)} {
+template<typename T>
+BaseFIRInterpolator<T>::BaseFIRInterpolator(int interp)
+  : BaseFIRInterpolator{interp, shared_multirate_fir(interp, 1)} {
 }
 
-FIRInterpolator::FIRInterpolator(int interp, span_real h)
-  : interp_{interp} {
-    h_ = polyphase(h, interp_, real_t(interp_), true);
-    sublen_ = h_[0].size();
-    d_ = zeros(sublen_ - 1);
+template<typename T>
+BaseFIRInterpolator<T>::BaseFIRInterpolator(int interp, span_real h)
+  : BaseFIRInterpolator{interp, std::make_shared<const PolyphaseTable>(interpolator_table(interp, h))} {
 }
 
-arr_real FIRInterpolator::process(span_real in) {
-    const int nx = in.size();
-    const int nh = sublen_;
-    const int nd = d_.size();
+template<typename T>
+BaseFIRInterpolator<T>::BaseFIRInterpolator(int interp, std::shared_ptr<const arr_real> h)
+  : BaseFIRInterpolator{interp, shared_polyphase_table(PolyphaseLayout::Interpolator, interp, 1, h)} {
+}
 
-    arr_real px(nd + nx);
-    std::memcpy(px.data(), d_.data(), nd * sizeof(real_t));
-    std::memcpy(px.data() + nd, in.data(), nx * sizeof(real_t));
-    std::memcpy(d_.data(), px.data() + nx, nd * sizeof(real_t));
+template<typename T>
+BaseFIRInterpolator<T>::BaseFIRInterpolator(int interp, std::shared_ptr<const PolyphaseTable> table)
+  : tab_{std::move(table)}
+  , interp_{interp}
+  , sublen_{tab_->sublen} {
+    d_ = base_array<T>(polyphase_buffer_size(sublen_ - 1, 1));
+}
 
-    auto y = arr_real(nx * interp_);
-    auto* py = y.data();
-    for (int i = 0; i < nx; ++i) {
-        for (int k = 0; k < interp_; ++k, ++py) {
-            for (int j = 0; j < nh; ++j) {
-                *py += px[i + j] * h_[k][j];
-            }
-        }
-    }
+template<typename T>
+base_array<T> BaseFIRInterpolator<T>::process(span_t<T> in) {
+    base_array<T> y(in.size() * interp_, uninitialized);
+    this->process(in, make_span(y));
     return y;
 }
 
-int FIRInterpolator::delay() const noexcept {
+template<typename T>
+void BaseFIRInterpolator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(out.size() == in.size() * interp_, "output frame length must be equal in.size() * interp");
+    T* py = out.data();
+    polyphase_frame(make_span(d_), sublen_ - 1, 1, in, [&](const T* x, int i, int n) {
+        polyphase_interpolate(x, tab_->taps<T>(), py + i * interp_, n, interp_, sublen_);
+    });
+}
+
+template<typename T>
+int BaseFIRInterpolator<T>::delay() const noexcept {
     return (sublen_ * interp_) / 2;
 }
 
-int FIRInterpolator::interp_rate() const noexcept {
+template<typename T>
+int BaseFIRInterpolator<T>::interp_rate() const noexcept {
     return interp_;
 }
 
-}   // namespace dsplib
\ No newline at end of file
+template class BaseFIRInterpolator<float>;
+template class BaseFIRInterpolator<double>;
+template class BaseFIRInterpolator<cmplx_t>;
+
+}   // namespace dsplib
@@ -1,79 +1,75 @@
 #include "dsplib/resample.h"
 
-#include <cassert>
+#include "resample/polyphase-kernels.h"
+#include "resample/polyphase-history.h"
+#include "resample/polyphase-tables.h"
 
 namespace dsplib {
 
-FIRRateConverter::FIRRateConverter(int interp, int decim)
-  : FIRRateConverter{interp, decim, design_multirate_fir(interp, decim)} {
+template<typename T>
+BaseFIRRateConverter<T>::BaseFIRRateConverter(int interp, int decim)
+  : BaseFIRRateConverter{interp, decim, shared_multirate_fir(interp, decim)} {
 }
 
-FIRRateConverter::FIRRateConverter(int interp, int decim, span_real h)
-  : interp_{interp}
-  , decim_{decim} {
-    const auto th = polyphase(h, interp_, real_t(interp_), true);
-    sublen_ = th[0].size();
-    d_ = zeros(sublen_ - 1);
-
-    //polyphase table access optimization
-    //example, for interp=3, decim=5 the processed brunches are (1 0 2)
-    int st = 0;
-    xidxs_.reserve(interp_);
-    for (int i = 0; i < decim_; ++i) {
-        for (int k = 0; k < interp_; ++k) {
-            st = st + 1;
-            if (st == decim_) {
-                h_.emplace_back(th[k]);
-                xidxs_.push_back(i);   //offset of input signal for each brunch
-                st = 0;
-            }
-        }
-    }
-
-    assert(int(h_.size()) == interp_);
-    assert(int(xidxs_.size()) == interp_);
+template<typename T>
+BaseFIRRateConverter<T>::BaseFIRRateConverter(int interp, int decim, span_real h)
+  : BaseFIRRateConverter{interp, decim, std::make_shared<const PolyphaseTable>(converter_table(interp, decim, h))} {
 }
 
-arr_real FIRRateConverter::process(span_real in) {
-    const int nx = in.size();
-    const int nh = sublen_;
-    const int nd = d_.size();
+template<typename T>
+BaseFIRRateConverter<T>::BaseFIRRateConverter(int interp, int decim, std::shared_ptr<const arr_real> h)
+  : BaseFIRRateConverter{interp, decim, shared_polyphase_table(PolyphaseLayout::Converter, interp, decim, h)} {
+}
 
-    DSPLIB_ASSERT(nx % decim_ == 0, "Input frame length must be a multiple of the 'decim'");
+template<typename T>
+BaseFIRRateConverter<T>::BaseFIRRateConverter(int interp, int decim, std::shared_ptr<const PolyphaseTable> table)
+  : tab_{std::move(table)}
+  , interp_{interp}
+  , decim_{decim}
+  , sublen_{tab_->sublen} {
+    d_ = base_array<T>(polyphase_buffer_size(sublen_ - 1, decim_));
+    acc_ = base_array<T>(decim_);
+}
 
-    arr_real x(nd + nx);
-    std::memcpy(x.data(), d_.data(), nd * sizeof(real_t));
-    std::memcpy(x.data() + nd, in.data(), nx * sizeof(real_t));
-    std::memcpy(d_.data(), x.data() + nx, nd * sizeof(real_t));
+template<typename T>
+base_array<T> BaseFIRRateConverter<T>::process(span_t<T> in) {
+    base_array<T> y(this->output_size(in.size()), uninitialized);
+    this->process(in, make_span(y));
+    return y;
+}
 
-    const int np = nx / decim_;
-    auto y = zeros(np * interp_);
-    auto* py = y.data();
-    for (int i = 0; i < np; ++i) {
-        for (int k = 0; k < interp_; ++k) {
-            const auto& h = h_[k];
-            const auto* px = x.data() + (i * decim_) + xidxs_[k];
-            for (int j = 0; j < nh; ++j) {
-                *py += px[j] * h[j];
-            }
-            ++py;
-        }
-    }
+template<typename T>
+void BaseFIRRateConverter<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(out.size() == this->output_size(in.size()), "Output frame length must be equal output_size()");
+    T* py = out.data();
+    polyphase_stream(make_span(d_), make_span(acc_), nacc_, sublen_ - 1, decim_, in, [&](const T* x, int i, int n) {
+        polyphase_convert(x, tab_->taps<T>(), tab_->xoffs.data(), py + i * interp_, n, interp_, decim_, sublen_);
+    });
+}
 
-    return y;
+template<typename T>
+int BaseFIRRateConverter<T>::output_size(int size) const noexcept {
+    return (nacc_ + size) / decim_ * interp_;
 }
 
-int FIRRateConverter::delay() const noexcept {
+template<typename T>
+int BaseFIRRateConverter<T>::delay() const noexcept {
     //TODO: must be N/2
     return sublen_ / 2 + 1;
 }
 
-int FIRRateConverter::interp_rate() const noexcept {
+template<typename T>
+int BaseFIRRateConverter<T>::interp_rate() const noexcept {
     return interp_;
 }
 
-[[nodiscard]] int FIRRateConverter::decim_rate() const noexcept {
+template<typename T>
+[[nodiscard]] int BaseFIRRateConverter<T>::decim_rate() const noexcept {
     return decim_;
 }
 
-}   // namespace dsplib
\ No newline at end of file
+template class BaseFIRRateConverter<float>;
+template class BaseFIRRateConverter<double>;
+template class BaseFIRRateConverter<cmplx_t>;
+
+}   // namespace dsplib
@@ -0,0 +1,144 @@
+#include "dsplib/resample.h"
+
+#include "resample/polyphase-kernels.h"
+#include "resample/polyphase-history.h"
+
+#include <cmath>
+
+namespace dsplib {
+
+template<typename T>
+class FractionalResamplerImpl
+{
+public:
+    explicit FractionalResamplerImpl(double ratio, int nphases, int hlen, real_t astop)
+      : nphases_{nphases} {
+        DSPLIB_ASSERT(ratio > 0, "resampling ratio must be positive");
+        DSPLIB_ASSERT(nphases > 0, "number of phases must be positive");
+
+        //for downsampling the cutoff frequency is scaled by the ratio (and the branches are longer)
+        const int nfilt = (ratio < 1) ? int(std::ceil(nphases / ratio)) : nphases;
+        const auto h = design_multirate_fir(nfilt, 1, hlen, astop);
+        const auto ph = IResampler::polyphase(h, nphases_, real_t(nphases_), true);
+        const int nb = ph[0].size();
+
+        //the first output is aligned to the beginning of the history
+        delay_ = 1 + double(h.size() - 1) / (2 * nphases_);
+
+        //branch `nphases` is the branch 0 delayed by one input sample, so all branches have (nb + 1) taps
+        sublen_ = nb + 1;
+        arr_real hh(sublen_ * (nphases_ + 1));
+        for (int k = 0; k < nphases_; ++k) {
+            hh.slice(k * sublen_, k * sublen_ + nb) = ph[k];
+        }
+        hh.slice(nphases_ * sublen_ + 1, (nphases_ + 1) * sublen_) = ph[0];
+
+        //the taps are stored at the sample precision
+        const arr_real hb = hh.slice(0, nphases_ * sublen_);
+        h_ = hb;
+        dh_ = arr_real(hh.slice(sublen_, (nphases_ + 1) * sublen_)) - hb;
+        d_ = base_array<T>(polyphase_buffer_size(sublen_ - 1, 1));
+        this->set_ratio(ratio);
+    }
+
+    //the windows overlapping the history are processed in the fixed buffer, the others read the input directly
+    void process(span_t<T> in, mut_span_t<T> out) {
+        DSPLIB_ASSERT(out.size() == this->output_size(in.size()), "Output frame length must be equal output_size()");
+        const int nd = sublen_ - 1;
+        T* py = out.data();
+        int ny = out.size();
+        polyphase_frame(make_span(d_), nd, 1, in, [&](const T* x, int i, int n) {
+            const int nr =
+              polyphase_farrow(x, i, n + nd, h_.data(), dh_.data(), nphases_, sublen_, pos_, step_, py, ny);
+            py += nr;
+            ny -= nr;
+        });
+        pos_ -= in.size();
+    }
+
+    //the same position sequence as in `polyphase_farrow`: the window [n, n + sublen) of [history | input]
+    //must fit into the buffer, so n < size
+    [[nodiscard]] int output_size(int size) const noexcept {
+        double p = pos_;
+        int ny = 0;
+        while (int(p) < size) {
+            p += step_;
+            ++ny;
+        }
+        return ny;
+    }
+
+    void set_ratio(double ratio) {
+        DSPLIB_ASSERT(ratio > 0, "resampling ratio must be positive");
+        ratio_ = ratio;
+        step_ = 1.0 / ratio;
+    }
+
+    [[nodiscard]] double ratio() const noexcept {
+        return ratio_;
+    }
+
+    [[nodiscard]] double delay() const noexcept {
+        return delay_;
+    }
+
+private:
+    const int nphases_;
+    int sublen_{0};
+    base_array<polyphase_tap_t<T>> h_;    ///< branches [nphases * sublen]
+    base_array<polyphase_tap_t<T>> dh_;   ///< differences of the adjacent branches [nphases * sublen]
+    double delay_{0};
+    double ratio_{1};
+    double step_{1};                      ///< input samples per output sample
+    double pos_{0};                       ///< position of the next output in [history | input] (input samples)
+    base_array<T> d_;                     ///< history buffer, see `polyphase_frame`
+};
+
+//------------------------------------------------------------------------------
+template<typename T>
+BaseFractionalResampler<T>::BaseFractionalResampler(double ratio, int nphases, int hlen, real_t astop)
+  : d_{std::make_shared<FractionalResamplerImpl<T>>(ratio, nphases, hlen, astop)} {
+}
+
+template<typename T>
+base_array<T> BaseFractionalResampler<T>::process(span_t<T> in) {
+    base_array<T> y(d_->output_size(in.size()), uninitialized);
+    d_->process(in, make_span(y));
+    return y;
+}
+
+template<typename T>
+void BaseFractionalResampler<T>::process(span_t<T> in, mut_span_t<T> out) {
+    d_->process(in, out);
+}
+
+template<typename T>
+int BaseFractionalResampler<T>::output_size(int size) const noexcept {
+    return d_->output_size(size);
+}
+
+template<typename T>
+void BaseFractionalResampler<T>::set_ratio(double ratio) {
+    d_->set_ratio(ratio);
+}
+
+template<typename T>
+double BaseFractionalResampler<T>::ratio() const noexcept {
+    return d_->ratio();
+}
+
+template<typename T>
+int BaseFractionalResampler<T>::delay() const noexcept {
+    return int(std::round(d_->delay()));
+}
+
+template<typename T>
+double BaseFractionalResampler<T>::frac_delay() const noexcept {
+    return d_->delay();
+}
+
+template class BaseFractionalResampler<float>;
+template class BaseFractionalResampler<double>;
+template class BaseFractionalResampler<cmplx_t>;
+
+}   // namespace dsplib
@@ -0,0 +1,121 @@
+#include "dsplib/resample.h"
+
+#include "resample/polyphase-kernels.h"
+#include "resample/polyphase-history.h"
+
+namespace dsplib {
+
+namespace {
+
+int _halfband_hlen(span_real h) {
+    DSPLIB_ASSERT((h.size() + 1) % 4 == 0, "half-band filter length must be 4 * hlen - 1");
+    return (h.size() + 1) / 4;
+}
+
+}   // namespace
+
+//------------------------------------------------------------------------------
+template<typename T>
+BaseHalfbandDecimator<T>::BaseHalfbandDecimator(int hlen, real_t astop)
+  : BaseHalfbandDecimator(design_halfband_fir(hlen, astop)) {
+}
+
+template<typename T>
+BaseHalfbandDecimator<T>::BaseHalfbandDecimator(span_real h)
+  : hlen_{_halfband_hlen(h)} {
+    const int m = 2 * hlen_ - 1;
+    const real_t gain = sum(h);
+    c_ = h[m] / gain;
+    g_ = arr_real(hlen_);
+    for (int j = 0; j < hlen_; ++j) {
+        g_[j] = h[m + 1 + 2 * j] / gain;
+    }
+    d_ = base_array<T>(polyphase_buffer_size(4 * hlen_ - 2, 2));
+    acc_ = base_array<T>(2);
+}
+
+template<typename T>
+base_array<T> BaseHalfbandDecimator<T>::process(span_t<T> in) {
+    base_array<T> y(this->output_size(in.size()), uninitialized);
+    this->process(in, make_span(y));
+    return y;
+}
+
+template<typename T>
+void BaseHalfbandDecimator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(out.size() == this->output_size(in.size()), "output frame length must be equal output_size()");
+    T* py = out.data();
+    polyphase_stream(make_span(d_), make_span(acc_), nacc_, 4 * hlen_ - 2, 2, in, [&](const T* x, int i, int n) {
+        halfband_decimate(x, g_.data(), c_, py + i, n, hlen_);
+    });
+}
+
+template<typename T>
+int BaseHalfbandDecimator<T>::output_size(int size) const noexcept {
+    return (nacc_ + size) / 2;
+}
+
+template<typename T>
+int BaseHalfbandDecimator<T>::delay() const noexcept {
+    return hlen_;
+}
+
+template<typename T>
+int BaseHalfbandDecimator<T>::decim_rate() const noexcept {
+    return 2;
+}
+
+template class BaseHalfbandDecimator<float>;
+template class BaseHalfbandDecimator<double>;
+template class BaseHalfbandDecimator<cmplx_t>;
+
+//------------------------------------------------------------------------------
+template<typename T>
+BaseHalfbandInterpolator<T>::BaseHalfbandInterpolator(int hlen, real_t astop)
+  : BaseHalfbandInterpolator(design_halfband_fir(hlen, astop)) {
+}
+
+template<typename T>
+BaseHalfbandInterpolator<T>::BaseHalfbandInterpolator(span_real h)
+  : hlen_{_halfband_hlen(h)} {
+    const int m = 2 * hlen_ - 1;
+    const real_t gain = 2 / sum(h);
+    c_ = h[m] * gain;
+    b_ = arr_real(hlen_);
+    for (int j = 0; j < hlen_; ++j) {
+        b_[j] = h[2 * j] * gain;
+    }
+    d_ = base_array<T>(polyphase_buffer_size(2 * hlen_ - 1, 1));
+}
+
+template<typename T>
+base_array<T> BaseHalfbandInterpolator<T>::process(span_t<T> in) {
+    base_array<T> y(in.size() * 2, uninitialized);
+    this->process(in, make_span(y));
+    return y;
+}
+
+template<typename T>
+void BaseHalfbandInterpolator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(out.size() == in.size() * 2, "output frame length must be equal in.size() * 2");
+    T* py = out.data();
+    polyphase_frame(make_span(d_), 2 * hlen_ - 1, 1, in, [&](const T* x, int i, int n) {
+        halfband_interpolate(x, b_.data(), c_, py + 2 * i, n, hlen_);
+    });
+}
+
+template<typename T>
+int BaseHalfbandInterpolator<T>::delay() const noexcept {
+    return 2 * hlen_;
+}
+
+template<typename T>
+int BaseHalfbandInterpolator<T>::interp_rate() const noexcept {
+    return 2;
+}
+
+template class BaseHalfbandInterpolator<float>;
+template class BaseHalfbandInterpolator<double>;
+template class BaseHalfbandInterpolator<cmplx_t>;
+
+}   // namespace dsplib
@@ -0,0 +1,204 @@
+#include "dsplib/resample.h"
+
+#include "resample/polyphase-kernels.h"
+#include "resample/polyphase-history.h"
+#include "resample/polyphase-tables.h"
+
+namespace dsplib {
+
+namespace {
+
+//decimation (interp = 1) uses the interleaved branches, interpolation/conversion uses the packed branches
+//(the interpolator layout is the converter one with decim = 1, interp = decim is the bypass mode)
+PolyphaseLayout _mc_layout(int interp) noexcept {
+    return (interp == 1) ? PolyphaseLayout::Decimator : PolyphaseLayout::Converter;
+}
+
+}   // namespace
+
+template<typename T>
+class MultiChannelResamplerImpl
+{
+public:
+    explicit MultiChannelResamplerImpl(int interp, int decim, std::shared_ptr<const PolyphaseTable> table,
+                                       int num_channels)
+      : nc_{num_channels}
+      , interp_{interp}
+      , decim_{decim}
+      , tab_{std::move(table)} {
+        DSPLIB_ASSERT(num_channels > 0, "number of channels must be positive");
+        if (tab_ != nullptr) {
+            //decimation: interleaved branches [decim * sublen], conversion/interpolation: packed branches
+            nd_ = (interp_ == 1) ? decim_ * (tab_->sublen - 1) : (tab_->sublen - 1);
+            d_ = base_array<T>(polyphase_buffer_size(nd_ * nc_, decim_ * nc_));
+            acc_ = base_array<T>(decim_ * nc_);
+        }
+    }
+
+    void process(span_t<T> in, mut_span_t<T> out) {
+        DSPLIB_ASSERT(in.size() % nc_ == 0, "input size must be a multiple of the number of channels");
+        DSPLIB_ASSERT(out.size() == this->output_size(in.size()), "output frame length must be equal output_size()");
+        if (tab_ == nullptr) {
+            out.assign(in);
+            return;
+        }
+
+        T* py = out.data();
+        const int nc = nc_;
+        const int sublen = tab_->sublen;
+        const auto* h = tab_->taps<T>();
+        const uint16_t* xoffs = tab_->xoffs.data();
+        auto fn = [&](const T* x, int i, int n) {
+            if (interp_ == 1) {
+                polyphase_decimate_mc(x, h, py + i * nc, n, decim_, decim_ * sublen, nc);
+            } else {
+                polyphase_convert_mc(x, h, xoffs, py + i * interp_ * nc, n, interp_, decim_, sublen, nc);
+            }
+        };
+        polyphase_stream(make_span(d_), make_span(acc_), nacc_, nd_ * nc_, decim_ * nc_, in, fn);
+    }
+
+    std::vector<base_array<T>> process(const std::vector<base_array<T>>& x) {
+        DSPLIB_ASSERT(int(x.size()) == nc_, "number of input channels mismatch");
+        const int n = x[0].size();
+        for (const auto& ch : x) {
+            DSPLIB_ASSERT(ch.size() == n, "all channels must have the same size");
+        }
+
+        //planar -> interleaved
+        inter_.resize(n * nc_);
+        for (int c = 0; c < nc_; ++c) {
+            const T* px = x[c].data();
+            for (int i = 0; i < n; ++i) {
+                inter_[i * nc_ + c] = px[i];
+            }
+        }
+
+        const int ny = this->output_size(inter_.size());
+        out_.resize(ny);
+        this->process(make_span(inter_), make_span(out_));
+
+        //interleaved -> planar
+        const int m = ny / nc_;
+        std::vector<base_array<T>> r(nc_, base_array<T>(m));
+        for (int c = 0; c < nc_; ++c) {
+            T* pr = r[c].data();
+            for (int i = 0; i < m; ++i) {
+                pr[i] = out_[i * nc_ + c];
+            }
+        }
+        return r;
+    }
+
+    [[nodiscard]] int output_size(int size) const noexcept {
+        return (nacc_ + size) / (decim_ * nc_) * interp_ * nc_;
+    }
+
+    [[nodiscard]] int num_channels() const noexcept {
+        return nc_;
+    }
+
+    //same as the single channel resamplers
+    [[nodiscard]] int delay() const noexcept {
+        if (tab_ == nullptr) {
+            return 0;
+        }
+        if (interp_ == 1) {
+            return tab_->sublen / 2;
+        }
+        if (decim_ == 1) {
+            return (tab_->sublen * interp_) / 2;
+        }
+        return tab_->sublen / 2 + 1;
+    }
+
+    [[nodiscard]] int interp_rate() const noexcept {
+        return interp_;
+    }
+
+    [[nodiscard]] int decim_rate() const noexcept {
+        return decim_;
+    }
+
+private:
+    const int nc_;
+    const int interp_;
+    const int decim_;
+    int nd_{0};                                   ///< filter history (frames)
+    std::shared_ptr<const PolyphaseTable> tab_;   ///< nullptr for the bypass mode
+    base_array<T> d_;                             ///< delay buffer [history | head of input]
+    base_array<T> acc_;                           ///< input remainder [decim * nc]
+    int nacc_{0};
+    std::vector<T> inter_;   ///< interleaved planar input
+    std::vector<T> out_;     ///< interleaved planar output
+};
+
+//-------------------------------------------------------------------------------------------------
+template<typename T>
+BaseMultiChannelResampler<T>::BaseMultiChannelResampler(int out_fs, int in_fs, int num_channels)
+  : BaseMultiChannelResampler(out_fs, in_fs, shared_multirate_fir(out_fs, in_fs), num_channels) {
+}
+
+//the table of the user filter is not cached (the cache key is the address of the shared filter)
+template<typename T>
+BaseMultiChannelResampler<T>::BaseMultiChannelResampler(int out_fs, int in_fs, span_real h, int num_channels) {
+    const auto [m, d] = BaseResampler<T>::simplify(out_fs, in_fs);
+    auto table = (m == d) ? nullptr : std::make_shared<const PolyphaseTable>(polyphase_table(_mc_layout(m), m, d, h));
+    d_ = std::make_shared<MultiChannelResamplerImpl<T>>(m, d, std::move(table), num_channels);
+}
+
+template<typename T>
+BaseMultiChannelResampler<T>::BaseMultiChannelResampler(int out_fs, int in_fs, std::shared_ptr<const arr_real> h,
+                                                        int num_channels) {
+    const auto [m, d] = BaseResampler<T>::simplify(out_fs, in_fs);
+    auto table = (m == d) ? nullptr : shared_polyphase_table(_mc_layout(m), m, d, h);
+    d_ = std::make_shared<MultiChannelResamplerImpl<T>>(m, d, std::move(table), num_channels);
+}
+
+template<typename T>
+base_array<T> BaseMultiChannelResampler<T>::process(span_t<T> x) {
+    base_array<T> r(d_->output_size(x.size()));
+    d_->process(x, make_span(r));
+    return r;
+}
+
+template<typename T>
+void BaseMultiChannelResampler<T>::process(span_t<T> in, mut_span_t<T> out) {
+    d_->process(in, out);
+}
+
+template<typename T>
+std::vector<base_array<T>> BaseMultiChannelResampler<T>::process(const std::vector<base_array<T>>& x) {
+    return d_->process(x);
+}
+
+template<typename T>
+int BaseMultiChannelResampler<T>::output_size(int size) const noexcept {
+    return d_->output_size(size);
+}
+
+template<typename T>
+int BaseMultiChannelResampler<T>::num_channels() const noexcept {
+    return d_->num_channels();
+}
+
+template<typename T>
+int BaseMultiChannelResampler<T>::delay() const noexcept {
+    return d_->delay();
+}
+
+template<typename T>
+int BaseMultiChannelResampler<T>::interp_rate() const noexcept {
+    return d_->interp_rate();
+}
+
+template<typename T>
+int BaseMultiChannelResampler<T>::decim_rate() const noexcept {
+    return d_->decim_rate();
+}
+
+template class BaseMultiChannelResampler<float>;
+template class BaseMultiChannelResampler<double>;
+template class BaseMultiChannelResampler<cmplx_t>;
+
+}   // namespace dsplib
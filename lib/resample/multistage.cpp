@@ -0,0 +1,305 @@
+#include "dsplib/resample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace dsplib {
+
+namespace {
+
+//Kaiser estimate of the FIR order, df - transition width (normalized to the sample rate)
+real_t _kaiser_len(real_t astop, real_t df) {
+    return (astop - real_t(7.95)) / (real_t(14.36) * df);
+}
+
+constexpr int MAX_STAGES = 6;
+
+//prime factorization: (prime, exponent), the trial division up to sqrt(m)
+std::vector<std::pair<int, int>> _prime_factors(int m) {
+    std::vector<std::pair<int, int>> out;
+    for (int p = 2; p <= m / p; ++p) {
+        int e = 0;
+        while (m % p == 0) {
+            m /= p;
+            ++e;
+        }
+        if (e > 0) {
+            out.emplace_back(p, e);
+        }
+    }
+    if (m > 1) {
+        out.emplace_back(m, 1);
+    }
+    return out;
+}
+
+//all divisors > 1 in the ascending order
+std::vector<int> _divisors(const std::vector<std::pair<int, int>>& pf) {
+    std::vector<int> out = {1};
+    for (const auto& [p, e] : pf) {
+        const int n = out.size();
+        int pk = 1;
+        for (int k = 0; k < e; ++k) {
+            pk *= p;
+            for (int i = 0; i < n; ++i) {
+                out.push_back(out[i] * pk);
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(out.begin());
+    return out;
+}
+
+//filter half-length of the intermediate stage, `rate` - input rate of the stage in the output rate units
+int _stage_hlen(int d, int rate, int hlen, real_t astop) {
+    //the transition band of the intermediate stage ends at the first frequency
+    //that is aliased into the final band: (rate_out - 1/2) - 1/2
+    //the estimate is the filter order: 2 * h * d - 1 for the polyphase filter and 4 * h - 2 for the half-band
+    const int rate_out = rate / d;
+    const real_t df = real_t(rate_out - 1) / rate;
+    const real_t order = _kaiser_len(astop, df);
+    const int h = (d == 2) ? int(std::ceil((order + 2) / 4)) : int(std::ceil((order + 1) / (2 * d)));
+    return std::max(1, std::min(h, hlen));
+}
+
+//multiply-accumulates per output sample of the stage
+real_t _stage_macs(int d, int h) {
+    //half-band stage uses only the non-zero taps with the folded symmetry
+    return (d == 2) ? real_t(h + 1) : real_t(2 * h) * d;
+}
+
+//stages are in the decimation order (from the highest rate)
+MultistagePlan _make_plan(const std::vector<int>& factors, int hlen, real_t astop) {
+    MultistagePlan plan;
+    plan.factors = factors;
+    int rate = 1;   ///< input rate of the stage in the output rate units
+    for (int f : factors) {
+        rate *= f;
+    }
+
+    const int ns = factors.size();
+    for (int i = 0; i < ns; ++i) {
+        const int d = factors[i];
+        const int rate_out = rate / d;
+        const int h = (i != ns - 1) ? _stage_hlen(d, rate, hlen, astop) : hlen;
+        plan.hlens.push_back(h);
+        plan.macs += _stage_macs(d, h) * rate_out;
+        rate = rate_out;
+    }
+    return plan;
+}
+
+//depth-first search of the stage factors with the branch and bound by the MAC count
+//the cost of the stage depends only on its input rate, so the partial sum is a lower bound of the plan cost
+class PlanSearch
+{
+public:
+    PlanSearch(int factor, int hlen, real_t astop)
+      : hlen_{hlen}
+      , astop_{astop}
+      , divs_{_divisors(_prime_factors(factor))} {
+        this->_search(factor, 0);
+    }
+
+    const std::vector<int>& factors() const noexcept {
+        return best_;
+    }
+
+private:
+    void _search(int rate, real_t macs) {
+        //the last stage is at least a half-band filter with `hlen`
+        if (macs + _stage_macs(2, hlen_) >= best_macs_) {
+            return;
+        }
+
+        //the last stage with the full filter
+        const real_t total = macs + _stage_macs(rate, hlen_);
+        if (total < best_macs_) {
+            best_macs_ = total;
+            best_ = cur_;
+            best_.push_back(rate);
+        }
+
+        if (int(cur_.size()) + 1 >= MAX_STAGES) {
+            return;
+        }
+        for (int d : divs_) {
+            if (d >= rate) {
+                break;
+            }
+            if (rate % d != 0) {
+                continue;
+            }
+            const int rate_out = rate / d;
+            cur_.push_back(d);
+            this->_search(rate_out, macs + _stage_macs(d, _stage_hlen(d, rate, hlen_, astop_)) * rate_out);
+            cur_.pop_back();
+        }
+    }
+
+    int hlen_;
+    real_t astop_;
+    std::vector<int> divs_;
+    std::vector<int> cur_;
+    std::vector<int> best_;
+    real_t best_macs_{std::numeric_limits<real_t>::max()};
+};
+
+}   // namespace
+
+//------------------------------------------------------------------------------
+MultistagePlan plan_multistage(int factor, int hlen, real_t astop) {
+    DSPLIB_ASSERT(factor > 0, "resampling factor must be positive");
+    DSPLIB_ASSERT(hlen > 0, "filter half-length must be positive");
+    if (factor == 1) {
+        return MultistagePlan{};
+    }
+    return _make_plan(PlanSearch(factor, hlen, astop).factors(), hlen, astop);
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+BaseMultistageDecimator<T>::BaseMultistageDecimator(int decim, int hlen, real_t astop)
+  : BaseMultistageDecimator(plan_multistage(decim, hlen, astop), astop) {
+}
+
+template<typename T>
+BaseMultistageDecimator<T>::BaseMultistageDecimator(const MultistagePlan& plan, real_t astop)
+  : plan_{plan} {
+    for (int i = 0; i < int(plan.factors.size()); ++i) {
+        const int d = plan.factors[i];
+        if (d == 2) {
+            stages_.push_back(std::make_shared<BaseHalfbandDecimator<T>>(plan.hlens[i], astop));
+        } else {
+            stages_.push_back(
+              std::make_shared<BaseFIRDecimator<T>>(d, design_multirate_fir(1, d, plan.hlens[i], astop)));
+        }
+        decim_ *= d;
+    }
+    bufs_.resize(stages_.size());
+}
+
+template<typename T>
+base_array<T> BaseMultistageDecimator<T>::process(span_t<T> in) {
+    base_array<T> y(in.size() / decim_, uninitialized);
+    this->process(in, make_span(y));
+    return y;
+}
+
+template<typename T>
+void BaseMultistageDecimator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(in.size() % decim_ == 0, "input frame length must be a multiple of the 'decim'");
+    DSPLIB_ASSERT(out.size() == in.size() / decim_, "output frame length must be equal in.size() / decim");
+    const int ns = stages_.size();
+    if (ns == 0) {
+        out.assign(in);
+        return;
+    }
+
+    span_t<T> x = in;
+    for (int i = 0; i < ns - 1; ++i) {
+        const int ny = x.size() / plan_.factors[i];
+        bufs_[i].resize(ny);
+        auto y = make_span(bufs_[i]);
+        stages_[i]->process(x, y);
+        x = y;
+    }
+    stages_[ns - 1]->process(x, out);
+}
+
+template<typename T>
+int BaseMultistageDecimator<T>::delay() const noexcept {
+    //the stage delays in the output samples
+    real_t dl = 0;
+    int rate = decim_;
+    for (int i = 0; i < int(stages_.size()); ++i) {
+        rate /= plan_.factors[i];
+        dl += real_t(stages_[i]->delay()) / rate;
+    }
+    return int(std::round(dl));
+}
+
+template<typename T>
+int BaseMultistageDecimator<T>::decim_rate() const noexcept {
+    return decim_;
+}
+
+template class BaseMultistageDecimator<float>;
+template class BaseMultistageDecimator<double>;
+template class BaseMultistageDecimator<cmplx_t>;
+
+//------------------------------------------------------------------------------
+template<typename T>
+BaseMultistageInterpolator<T>::BaseMultistageInterpolator(int interp, int hlen, real_t astop)
+  : BaseMultistageInterpolator(plan_multistage(interp, hlen, astop), astop) {
+}
+
+template<typename T>
+BaseMultistageInterpolator<T>::BaseMultistageInterpolator(const MultistagePlan& plan, real_t astop)
+  : plan_{plan} {
+    //transposed decimation plan: from the lowest rate
+    const int ns = plan.factors.size();
+    for (int i = ns - 1; i >= 0; --i) {
+        const int l = plan.factors[i];
+        if (l == 2) {
+            stages_.push_back(std::make_shared<BaseHalfbandInterpolator<T>>(plan.hlens[i], astop));
+        } else {
+            stages_.push_back(
+              std::make_shared<BaseFIRInterpolator<T>>(l, design_multirate_fir(l, 1, plan.hlens[i], astop)));
+        }
+        interp_ *= l;
+    }
+    bufs_.resize(stages_.size());
+}
+
+template<typename T>
+base_array<T> BaseMultistageInterpolator<T>::process(span_t<T> in) {
+    base_array<T> y(in.size() * interp_, uninitialized);
+    this->process(in, make_span(y));
+    return y;
+}
+
+template<typename T>
+void BaseMultistageInterpolator<T>::process(span_t<T> in, mut_span_t<T> out) {
+    DSPLIB_ASSERT(out.size() == in.size() * interp_, "output frame length must be equal in.size() * interp");
+    const int ns = stages_.size();
+    if (ns == 0) {
+        out.assign(in);
+        return;
+    }
+
+    span_t<T> x = in;
+    for (int i = 0; i < ns - 1; ++i) {
+        const int ny = x.size() * stages_[i]->interp_rate();
+        bufs_[i].resize(ny);
+        auto y = make_span(bufs_[i]);
+        stages_[i]->process(x, y);
+        x = y;
+    }
+    stages_[ns - 1]->process(x, out);
+}
+
+template<typename T>
+int BaseMultistageInterpolator<T>::delay() const noexcept {
+    //the stage delays in the output samples
+    int dl = 0;
+    int rate = interp_;
+    for (const auto& stage : stages_) {
+        rate /= stage->interp_rate();
+        dl += stage->delay() * rate;
+    }
+    return dl;
+}
+
+template<typename T>
+int BaseMultistageInterpolator<T>::interp_rate() const noexcept {
+    return interp_;
+}
+
+template class BaseMultistageInterpolator<float>;
+template class BaseMultistageInterpolator<double>;
+template class BaseMultistageInterpolator<cmplx_t>;
+
+}   // namespace dsplib
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <dsplib/array.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace dsplib {
+
+//size of the delay buffer for `polyphase_frame`
+constexpr int polyphase_buffer_size(int nd, int step) noexcept {
+    return 2 * nd + step;
+}
+
+//Frame processing of the polyphase filter without allocations
+//The group of outputs `i` reads the samples X[i * step, i * step + nd + step) of the virtual signal
+//X = [history[nd] | input]. Only the first groups (which overlap the history) are processed in the fixed
+//buffer `buf` [history | head of input], the other groups read the caller input directly.
+//fn(const T* x, int first_group, int num_groups), `in.size()` must be a multiple of the step
+template<typename T, typename Fn>
+void polyphase_frame(mut_span_t<T> buf, int nd, int step, span_t<T> in, Fn&& fn) {
+    const int nx = in.size();
+    const int np = nx / step;
+    T* pb = buf.data();
+    assert(buf.size() == polyphase_buffer_size(nd, step));
+
+    //groups overlapping the history
+    const int nhead = std::min((nd + step - 1) / step, np);
+    if (nhead > 0) {
+        std::copy(in.data(), in.data() + nhead * step, pb + nd);
+        fn(static_cast<const T*>(pb), 0, nhead);
+    }
+
+    //groups inside the input frame
+    if (np > nhead) {
+        fn(in.data() + (nhead * step - nd), nhead, np - nhead);
+    }
+
+    //update history, if nx < nd the buffer contains [history | input]
+    if (nx >= nd) {
+        std::copy(in.data() + (nx - nd), in.data() + nx, pb);
+    } else if (nx > 0) {
+        std::copy(pb + nx, pb + nx + nd, pb);
+    }
+}
+
+//Frame processing of any input length: the tail of the input (less than `step` samples) is accumulated in
+//`acc` [step] until the next call, `nacc` - number of the accumulated samples (updated)
+//the number of processed groups is (nacc + in.size()) / step, the groups are numbered from 0 for each call
+template<typename T, typename Fn>
+void polyphase_stream(mut_span_t<T> buf, mut_span_t<T> acc, int& nacc, int nd, int step, span_t<T> in, Fn&& fn) {
+    const T* px = in.data();
+    int nx = in.size();
+    int ngroups = 0;
+    assert(acc.size() == step);
+
+    //complete the accumulated group
+    if (nacc > 0) {
+        const int n = std::min(step - nacc, nx);
+        std::copy(px, px + n, acc.data() + nacc);
+        nacc += n;
+        px += n;
+        nx -= n;
+        if (nacc < step) {
+            return;
+        }
+        polyphase_frame(buf, nd, step, span_t<T>(acc.data(), step), fn);
+        nacc = 0;
+        ngroups = 1;
+    }
+
+    const int nfull = nx / step * step;
+    if (nfull > 0) {
+        polyphase_frame(buf, nd, step, span_t<T>(px, nfull), [&](const T* x, int i, int n) {
+            fn(x, i + ngroups, n);
+        });
+    }
+
+    nacc = nx - nfull;
+    std::copy(px + nfull, px + nx, acc.data());
+}
+
+}   // namespace dsplib
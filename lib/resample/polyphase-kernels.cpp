@@ -0,0 +1,345 @@
+// This translation unit may be compiled with unsafe floating-point optimizations
+// when DSPLIB_SAFE_MATH=OFF (see lib/math_kernels.cpp).
+
+#include "resample/polyphase-kernels.h"
+
+#include "internal/dispatch.h"
+
+#include <type_traits>
+
+namespace dsplib {
+
+namespace {
+
+//The kernels are structs with the static `run` function (see internal/dispatch.h), so they must be plain loops
+//without calls of non-inline functions.
+
+//independent accumulators break the dependency chain of the reduction
+//T - float or double, H - tap type (polyphase_tap_t<T>)
+template<typename T, typename H>
+inline T _dot(const T* restrict x, const H* restrict h, int n) noexcept {
+    T acc0 = 0;
+    T acc1 = 0;
+    T acc2 = 0;
+    T acc3 = 0;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 += x[i] * h[i];
+        acc1 += x[i + 1] * h[i + 1];
+        acc2 += x[i + 2] * h[i + 2];
+        acc3 += x[i + 3] * h[i + 3];
+    }
+    for (; i < n; ++i) {
+        acc0 += x[i] * h[i];
+    }
+    return (acc0 + acc1) + (acc2 + acc3);
+}
+
+//real taps for the interleaved IQ samples, one tap is applied to re/im pair
+inline cmplx_t _dot(const cmplx_t* restrict x, const real_t* restrict h, int n) noexcept {
+    const real_t* restrict px = reinterpret_cast<const real_t*>(x);
+    real_t re0 = 0;
+    real_t im0 = 0;
+    real_t re1 = 0;
+    real_t im1 = 0;
+    int i = 0;
+    for (; i + 2 <= n; i += 2) {
+        re0 += px[2 * i] * h[i];
+        im0 += px[2 * i + 1] * h[i];
+        re1 += px[2 * i + 2] * h[i + 1];
+        im1 += px[2 * i + 3] * h[i + 1];
+    }
+    for (; i < n; ++i) {
+        re0 += px[2 * i] * h[i];
+        im0 += px[2 * i + 1] * h[i];
+    }
+    return {re0 + re1, im0 + im1};
+}
+
+//dot(x, h) + mu * dot(x, dh) in one pass
+template<typename T, typename H>
+inline T _farrow_dot(const T* restrict x, const H* restrict h, const H* restrict dh, T mu, int n) noexcept {
+    T acc0 = 0;
+    T acc1 = 0;
+    for (int i = 0; i < n; ++i) {
+        acc0 += x[i] * h[i];
+        acc1 += x[i] * dh[i];
+    }
+    return acc0 + mu * acc1;
+}
+
+inline cmplx_t _farrow_dot(const cmplx_t* restrict x, const real_t* restrict h, const real_t* restrict dh, real_t mu,
+                           int n) noexcept {
+    const real_t* restrict px = reinterpret_cast<const real_t*>(x);
+    real_t re0 = 0;
+    real_t im0 = 0;
+    real_t re1 = 0;
+    real_t im1 = 0;
+    for (int i = 0; i < n; ++i) {
+        re0 += px[2 * i] * h[i];
+        im0 += px[2 * i + 1] * h[i];
+        re1 += px[2 * i] * dh[i];
+        im1 += px[2 * i + 1] * dh[i];
+    }
+    return {re0 + mu * re1, im0 + mu * im1};
+}
+
+//the position is passed by the pointer (the dispatched arguments are copied)
+struct FarrowKernel
+{
+    template<typename T, typename H>
+    static int run(const T* restrict x, int x0, int nx, const H* restrict h, const H* restrict dh, int nphases,
+                   int sublen, double* pos, double step, T* restrict y, int ny) noexcept {
+        using R = std::conditional_t<std::is_same_v<T, cmplx_t>, real_t, T>;
+        double p = *pos;
+        int k = 0;
+        while (k < ny) {
+            const int n = int(p);
+            if (n - x0 + sublen > nx) {
+                break;
+            }
+            const double ph = (p - n) * nphases;
+            const int ip = int(ph);
+            const R mu = R(ph - ip);
+            y[k] = _farrow_dot(x + (n - x0), h + ip * sublen, dh + ip * sublen, mu, sublen);
+            p += step;
+            ++k;
+        }
+        *pos = p;
+        return k;
+    }
+};
+
+struct HalfbandDecimateKernel
+{
+    template<typename T>
+    static void run(const T* restrict x, const real_t* restrict g, real_t c, T* restrict y, int ny,
+                    int hlen) noexcept {
+        const int m = 2 * hlen - 1;
+        for (int i = 0; i < ny; ++i) {
+            const T* restrict px = x + 2 * i;
+            T acc = c * px[m];
+            for (int j = 0; j < hlen; ++j) {
+                acc += g[j] * (px[m - 1 - 2 * j] + px[m + 1 + 2 * j]);
+            }
+            y[i] = acc;
+        }
+    }
+};
+
+struct HalfbandInterpolateKernel
+{
+    template<typename T>
+    static void run(const T* restrict x, const real_t* restrict b, real_t c, T* restrict y, int nx,
+                    int hlen) noexcept {
+        const int n = 2 * hlen - 1;
+        for (int i = 0; i < nx; ++i) {
+            const T* restrict px = x + i;
+            T acc = 0;
+            for (int j = 0; j < hlen; ++j) {
+                acc += b[j] * (px[j] + px[n - j]);
+            }
+            y[2 * i] = acc;
+            y[2 * i + 1] = c * px[hlen];
+        }
+    }
+};
+
+struct DecimateKernel
+{
+    template<typename T, typename H>
+    static void run(const T* restrict x, const H* restrict h, T* restrict y, int ny, int decim, int hlen) noexcept {
+        for (int i = 0; i < ny; ++i) {
+            y[i] = _dot(x + i * decim, h, hlen);
+        }
+    }
+};
+
+struct InterpolateKernel
+{
+    template<typename T, typename H>
+    static void run(const T* restrict x, const H* restrict h, T* restrict y, int nx, int interp, int sublen) noexcept {
+        for (int i = 0; i < nx; ++i) {
+            const T* restrict px = x + i;
+            for (int k = 0; k < interp; ++k) {
+                *y++ = _dot(px, h + k * sublen, sublen);
+            }
+        }
+    }
+};
+
+struct ConvertKernel
+{
+    template<typename T, typename H>
+    static void run(const T* restrict x, const H* restrict h, const uint16_t* restrict xoffs, T* restrict y, int np,
+                    int interp, int decim, int sublen) noexcept {
+        for (int i = 0; i < np; ++i) {
+            const T* restrict px = x + i * decim;
+            for (int k = 0; k < interp; ++k) {
+                *y++ = _dot(px + xoffs[k], h + k * sublen, sublen);
+            }
+        }
+    }
+};
+
+//y[c] = sum(h[t] * x[t * nc + c])
+template<typename T, typename H>
+inline void _dot_mc(const T* restrict x, const H* restrict h, T* restrict y, int n, int nc) noexcept {
+    for (int c = 0; c < nc; ++c) {
+        y[c] = 0;
+    }
+    for (int t = 0; t < n; ++t) {
+        const T ht = h[t];
+        const T* restrict px = x + t * nc;
+        for (int c = 0; c < nc; ++c) {
+            y[c] += px[c] * ht;
+        }
+    }
+}
+
+struct DecimateMcKernel
+{
+    template<typename T, typename H>
+    static void run(const T* restrict x, const H* restrict h, T* restrict y, int ny, int decim, int hlen,
+                    int nc) noexcept {
+        for (int i = 0; i < ny; ++i) {
+            _dot_mc(x + i * decim * nc, h, y + i * nc, hlen, nc);
+        }
+    }
+};
+
+struct ConvertMcKernel
+{
+    template<typename T, typename H>
+    static void run(const T* restrict x, const H* restrict h, const uint16_t* restrict xoffs, T* restrict y, int np,
+                    int interp, int decim, int sublen, int nc) noexcept {
+        for (int i = 0; i < np; ++i) {
+            const T* restrict px = x + i * decim * nc;
+            for (int k = 0; k < interp; ++k) {
+                _dot_mc(px + xoffs[k] * nc, h + k * sublen, y, sublen, nc);
+                y += nc;
+            }
+        }
+    }
+};
+
+}   // namespace
+
+//-------------------------------------------------------------------------------------------------
+void polyphase_decimate(const float* x, const float* h, float* y, int ny, int decim, int hlen) noexcept {
+    dispatch<DecimateKernel>(x, h, y, ny, decim, hlen);
+}
+
+void polyphase_decimate(const double* x, const real_t* h, double* y, int ny, int decim, int hlen) noexcept {
+    dispatch<DecimateKernel>(x, h, y, ny, decim, hlen);
+}
+
+void polyphase_decimate(const cmplx_t* x, const real_t* h, cmplx_t* y, int ny, int decim, int hlen) noexcept {
+    dispatch<DecimateKernel>(x, h, y, ny, decim, hlen);
+}
+
+//-------------------------------------------------------------------------------------------------
+void polyphase_interpolate(const float* x, const float* h, float* y, int nx, int interp, int sublen) noexcept {
+    dispatch<InterpolateKernel>(x, h, y, nx, interp, sublen);
+}
+
+void polyphase_interpolate(const double* x, const real_t* h, double* y, int nx, int interp, int sublen) noexcept {
+    dispatch<InterpolateKernel>(x, h, y, nx, interp, sublen);
+}
+
+void polyphase_interpolate(const cmplx_t* x, const real_t* h, cmplx_t* y, int nx, int interp, int sublen) noexcept {
+    dispatch<InterpolateKernel>(x, h, y, nx, interp, sublen);
+}
+
+//-------------------------------------------------------------------------------------------------
+void polyphase_convert(const float* x, const float* h, const uint16_t* xoffs, float* y, int np, int interp,
+                       int decim, int sublen) noexcept {
+    dispatch<ConvertKernel>(x, h, xoffs, y, np, interp, decim, sublen);
+}
+
+void polyphase_convert(const double* x, const real_t* h, const uint16_t* xoffs, double* y, int np, int interp,
+                       int decim, int sublen) noexcept {
+    dispatch<ConvertKernel>(x, h, xoffs, y, np, interp, decim, sublen);
+}
+
+void polyphase_convert(const cmplx_t* x, const real_t* h, const uint16_t* xoffs, cmplx_t* y, int np, int interp,
+                       int decim, int sublen) noexcept {
+    dispatch<ConvertKernel>(x, h, xoffs, y, np, interp, decim, sublen);
+}
+
+//-------------------------------------------------------------------------------------------------
+void polyphase_decimate_mc(const float* x, const float* h, float* y, int ny, int decim, int hlen, int nc) noexcept {
+    dispatch<DecimateMcKernel>(x, h, y, ny, decim, hlen, nc);
+}
+
+void polyphase_decimate_mc(const double* x, const real_t* h, double* y, int ny, int decim, int hlen, int nc) noexcept {
+    dispatch<DecimateMcKernel>(x, h, y, ny, decim, hlen, nc);
+}
+
+//complex channels are processed as 2 * nc real lanes
+void polyphase_decimate_mc(const cmplx_t* x, const real_t* h, cmplx_t* y, int ny, int decim, int hlen,
+                           int nc) noexcept {
+    dispatch<DecimateMcKernel>(reinterpret_cast<const real_t*>(x), h, reinterpret_cast<real_t*>(y), ny, decim, hlen,
+                               2 * nc);
+}
+
+//-------------------------------------------------------------------------------------------------
+void polyphase_convert_mc(const float* x, const float* h, const uint16_t* xoffs, float* y, int np, int interp,
+                          int decim, int sublen, int nc) noexcept {
+    dispatch<ConvertMcKernel>(x, h, xoffs, y, np, interp, decim, sublen, nc);
+}
+
+void polyphase_convert_mc(const double* x, const real_t* h, const uint16_t* xoffs, double* y, int np, int interp,
+                          int decim, int sublen, int nc) noexcept {
+    dispatch<ConvertMcKernel>(x, h, xoffs, y, np, interp, decim, sublen, nc);
+}
+
+void polyphase_convert_mc(const cmplx_t* x, const real_t* h, const uint16_t* xoffs, cmplx_t* y, int np, int interp,
+                          int decim, int sublen, int nc) noexcept {
+    dispatch<ConvertMcKernel>(reinterpret_cast<const real_t*>(x), h, xoffs, reinterpret_cast<real_t*>(y), np, interp,
+                              decim, sublen, 2 * nc);
+}
+
+//-------------------------------------------------------------------------------------------------
+int polyphase_farrow(const float* x, int x0, int nx, const float* h, const float* dh, int nphases, int sublen,
+                     double& pos, double step, float* y, int ny) noexcept {
+    return dispatch<FarrowKernel>(x, x0, nx, h, dh, nphases, sublen, &pos, step, y, ny);
+}
+
+int polyphase_farrow(const double* x, int x0, int nx, const real_t* h, const real_t* dh, int nphases, int sublen,
+                     double& pos, double step, double* y, int ny) noexcept {
+    return dispatch<FarrowKernel>(x, x0, nx, h, dh, nphases, sublen, &pos, step, y, ny);
+}
+
+int polyphase_farrow(const cmplx_t* x, int x0, int nx, const real_t* h, const real_t* dh, int nphases, int sublen,
+                     double& pos, double step, cmplx_t* y, int ny) noexcept {
+    return dispatch<FarrowKernel>(x, x0, nx, h, dh, nphases, sublen, &pos, step, y, ny);
+}
+
+//-------------------------------------------------------------------------------------------------
+void halfband_decimate(const float* x, const real_t* g, real_t c, float* y, int ny, int hlen) noexcept {
+    dispatch<HalfbandDecimateKernel>(x, g, c, y, ny, hlen);
+}
+
+void halfband_decimate(const double* x, const real_t* g, real_t c, double* y, int ny, int hlen) noexcept {
+    dispatch<HalfbandDecimateKernel>(x, g, c, y, ny, hlen);
+}
+
+void halfband_decimate(const cmplx_t* x, const real_t* g, real_t c, cmplx_t* y, int ny, int hlen) noexcept {
+    dispatch<HalfbandDecimateKernel>(x, g, c, y, ny, hlen);
+}
+
+//-------------------------------------------------------------------------------------------------
+void halfband_interpolate(const float* x, const real_t* b, real_t c, float* y, int nx, int hlen) noexcept {
+    dispatch<HalfbandInterpolateKernel>(x, b, c, y, nx, hlen);
+}
+
+void halfband_interpolate(const double* x, const real_t* b, real_t c, double* y, int nx, int hlen) noexcept {
+    dispatch<HalfbandInterpolateKernel>(x, b, c, y, nx, hlen);
+}
+
+void halfband_interpolate(const cmplx_t* x, const real_t* b, real_t c, cmplx_t* y, int nx, int hlen) noexcept {
+    dispatch<HalfbandInterpolateKernel>(x, b, c, y, nx, hlen);
+}
+
+}   // namespace dsplib
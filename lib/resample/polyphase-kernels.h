@@ -0,0 +1,86 @@
+#pragma once
+
+#include <dsplib/types.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace dsplib {
+
+//polyphase FIR kernels for the resamplers
+//implemented in a separate translation unit, which is compiled with unsafe floating-point optimizations
+//when DSPLIB_SAFE_MATH=OFF (see lib/math_kernels.cpp)
+//the real input is float or double, complex input is processed as interleaved IQ pairs
+//the polyphase taps have the sample precision (float for the float input, real_t otherwise), so the float kernels
+//do not convert the samples to double; the half-band taps are real_t
+//the kernels are dispatched by the CPU features (see internal/dispatch.h)
+
+//tap type of the polyphase kernels for the sample type `T`
+template<typename T>
+using polyphase_tap_t = std::conditional_t<std::is_same_v<T, float>, float, real_t>;
+
+//decimation: y[i] = dot(x + i * decim, h, hlen)
+//h - interleaved branches, h[j * decim + k] is the tap `j` of the branch `k` (hlen = decim * sublen),
+//so one contiguous load of the input feeds all phases
+void polyphase_decimate(const float* x, const float* h, float* y, int ny, int decim, int hlen) noexcept;
+void polyphase_decimate(const double* x, const real_t* h, double* y, int ny, int decim, int hlen) noexcept;
+void polyphase_decimate(const cmplx_t* x, const real_t* h, cmplx_t* y, int ny, int decim, int hlen) noexcept;
+
+//interpolation: y[i * interp + k] = dot(x + i, h + k * sublen, sublen)
+//h - contiguous branches [interp * sublen]
+void polyphase_interpolate(const float* x, const float* h, float* y, int nx, int interp, int sublen) noexcept;
+void polyphase_interpolate(const double* x, const real_t* h, double* y, int nx, int interp, int sublen) noexcept;
+void polyphase_interpolate(const cmplx_t* x, const real_t* h, cmplx_t* y, int nx, int interp, int sublen) noexcept;
+
+//rate conversion: y[i * interp + k] = dot(x + i * decim + xoffs[k], h + k * sublen, sublen)
+//h - contiguous branches [interp * sublen] in the processing order
+void polyphase_convert(const float* x, const float* h, const uint16_t* xoffs, float* y, int np, int interp,
+                       int decim, int sublen) noexcept;
+void polyphase_convert(const double* x, const real_t* h, const uint16_t* xoffs, double* y, int np, int interp,
+                       int decim, int sublen) noexcept;
+void polyphase_convert(const cmplx_t* x, const real_t* h, const uint16_t* xoffs, cmplx_t* y, int np, int interp,
+                       int decim, int sublen) noexcept;
+
+//fractional resampling with linear interpolation between the phases (first-order Farrow structure):
+//y = dot(x + n, h[k]) + mu * dot(x + n, dh[k]), where n + (k + mu) / nphases is the output time
+//h, dh - branches and their differences [nphases * sublen], pos - position of the next output (updated)
+//x0 - position of x[0], the position is not shifted to x, so the split of the signal does not change the rounding
+//result: number of outputs (the last window must fit in x, at most `ny` outputs)
+int polyphase_farrow(const float* x, int x0, int nx, const float* h, const float* dh, int nphases, int sublen,
+                     double& pos, double step, float* y, int ny) noexcept;
+int polyphase_farrow(const double* x, int x0, int nx, const real_t* h, const real_t* dh, int nphases, int sublen,
+                     double& pos, double step, double* y, int ny) noexcept;
+int polyphase_farrow(const cmplx_t* x, int x0, int nx, const real_t* h, const real_t* dh, int nphases, int sublen,
+                     double& pos, double step, cmplx_t* y, int ny) noexcept;
+
+//multichannel versions, the channels are interleaved lanes [x0(ch0), x0(ch1), ..., x1(ch0), ...]
+//one tap is applied to all channels at once, so the inner loop is vectorized across channels
+//decimation: y[i * nc + c] = sum(h[t] * x[(i * decim + t) * nc + c]), h - interleaved branches [hlen]
+void polyphase_decimate_mc(const float* x, const float* h, float* y, int ny, int decim, int hlen, int nc) noexcept;
+void polyphase_decimate_mc(const double* x, const real_t* h, double* y, int ny, int decim, int hlen, int nc) noexcept;
+void polyphase_decimate_mc(const cmplx_t* x, const real_t* h, cmplx_t* y, int ny, int decim, int hlen,
+                           int nc) noexcept;
+
+//rate conversion: y[(i * interp + k) * nc + c] = sum(h[k * sublen + j] * x[(i * decim + xoffs[k] + j) * nc + c])
+void polyphase_convert_mc(const float* x, const float* h, const uint16_t* xoffs, float* y, int np, int interp,
+                          int decim, int sublen, int nc) noexcept;
+void polyphase_convert_mc(const double* x, const real_t* h, const uint16_t* xoffs, double* y, int np, int interp,
+                          int decim, int sublen, int nc) noexcept;
+void polyphase_convert_mc(const cmplx_t* x, const real_t* h, const uint16_t* xoffs, cmplx_t* y, int np, int interp,
+                          int decim, int sublen, int nc) noexcept;
+
+//half-band decimation by 2 (only non-zero taps, folded symmetry)
+//y[i] = c * x[2i + m] + sum(g[j] * (x[2i + m - 1 - 2j] + x[2i + m + 1 + 2j])), m = 2 * hlen - 1
+//g - [hlen] non-zero side taps, c - center tap
+void halfband_decimate(const float* x, const real_t* g, real_t c, float* y, int ny, int hlen) noexcept;
+void halfband_decimate(const double* x, const real_t* g, real_t c, double* y, int ny, int hlen) noexcept;
+void halfband_decimate(const cmplx_t* x, const real_t* g, real_t c, cmplx_t* y, int ny, int hlen) noexcept;
+
+//half-band interpolation by 2 (only non-zero taps, folded symmetry)
+//y[2i] = sum(b[j] * (x[i + j] + x[i + 2 * hlen - 1 - j])), y[2i + 1] = c * x[i + hlen]
+//b - [hlen] symmetric branch taps, c - center tap
+void halfband_interpolate(const float* x, const real_t* b, real_t c, float* y, int nx, int hlen) noexcept;
+void halfband_interpolate(const double* x, const real_t* b, real_t c, double* y, int nx, int hlen) noexcept;
+void halfband_interpolate(const cmplx_t* x, const real_t* b, real_t c, cmplx_t* y, int nx, int hlen) noexcept;
+
+}   // namespace dsplib
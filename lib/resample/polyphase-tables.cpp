@@ -0,0 +1,133 @@
+#include "dsplib/resample.h"
+
+#include "resample/polyphase-tables.h"
+#include "internal/lru-cache.h"
+
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+namespace dsplib {
+
+namespace {
+
+constexpr int TABLE_CACHE_SIZE = 16;
+
+struct TableKey
+{
+    PolyphaseLayout layout;
+    int interp;
+    int decim;
+    const arr_real* h;
+
+    bool operator==(const TableKey& rhs) const noexcept {
+        return (layout == rhs.layout) && (interp == rhs.interp) && (decim == rhs.decim) && (h == rhs.h);
+    }
+};
+
+struct TableKeyHash
+{
+    size_t operator()(const TableKey& k) const noexcept {
+        const size_t seed = std::hash<const void*>{}(k.h);
+        return seed ^ (size_t(k.interp) * 0x9E3779B1U) ^ (size_t(k.decim) << 16) ^ (size_t(k.layout) << 30);
+    }
+};
+
+struct TableEntry
+{
+    std::shared_ptr<const arr_real> h;   ///< keeps the key address valid
+    std::shared_ptr<const PolyphaseTable> table;
+};
+
+//the float copy of the packed branches (the taps of the float samples)
+PolyphaseTable _with_sample_taps(PolyphaseTable r) {
+    if constexpr (!std::is_same_v<real_t, float>) {
+        r.hf = r.h;
+    }
+    return r;
+}
+
+}   // namespace
+
+//------------------------------------------------------------------------------
+PolyphaseTable decimator_table(int decim, span_real h) {
+    const auto ph = IResampler::polyphase(h, decim, 1.0, false);
+    PolyphaseTable r;
+    r.sublen = ph[0].size();
+    r.h = zeros(decim * r.sublen);
+    for (int k = 0; k < decim; ++k) {
+        for (int j = 0; j < r.sublen; ++j) {
+            r.h[j * decim + k] = ph[k][j];
+        }
+    }
+    return _with_sample_taps(std::move(r));
+}
+
+PolyphaseTable interpolator_table(int interp, span_real h) {
+    const auto ph = IResampler::polyphase(h, interp, real_t(interp), true);
+    PolyphaseTable r;
+    r.sublen = ph[0].size();
+    r.h = zeros(interp * r.sublen);
+    for (int k = 0; k < interp; ++k) {
+        r.h.slice(k * r.sublen, (k + 1) * r.sublen) = ph[k];
+    }
+    r.xoffs.assign(interp, 0);
+    return _with_sample_taps(std::move(r));
+}
+
+PolyphaseTable converter_table(int interp, int decim, span_real h) {
+    const auto th = IResampler::polyphase(h, interp, real_t(interp), true);
+    PolyphaseTable r;
+    r.sublen = th[0].size();
+
+    //polyphase table access optimization
+    //example, for interp=3, decim=5 the processed brunches are (1 0 2)
+    int st = 0;
+    r.xoffs.reserve(interp);
+    r.h = zeros(interp * r.sublen);
+    int nbr = 0;
+    for (int i = 0; i < decim; ++i) {
+        for (int k = 0; k < interp; ++k) {
+            st = st + 1;
+            if (st == decim) {
+                r.h.slice(nbr * r.sublen, (nbr + 1) * r.sublen) = th[k];
+                r.xoffs.push_back(i);   //offset of input signal for each brunch
+                ++nbr;
+                st = 0;
+            }
+        }
+    }
+
+    assert(nbr == interp);
+    assert(int(r.xoffs.size()) == interp);
+    return _with_sample_taps(std::move(r));
+}
+
+//------------------------------------------------------------------------------
+PolyphaseTable polyphase_table(PolyphaseLayout layout, int interp, int decim, span_real h) {
+    switch (layout) {
+    case PolyphaseLayout::Decimator:
+        return decimator_table(decim, h);
+    case PolyphaseLayout::Interpolator:
+        return interpolator_table(interp, h);
+    case PolyphaseLayout::Converter:
+        return converter_table(interp, decim, h);
+    }
+    DSPLIB_THROW("unknown polyphase table layout");
+}
+
+std::shared_ptr<const PolyphaseTable> shared_polyphase_table(PolyphaseLayout layout, int interp, int decim,
+                                                             const std::shared_ptr<const arr_real>& h) {
+    DSPLIB_ASSERT(h != nullptr, "filter pointer is null");
+    const TableKey key{layout, interp, decim, h.get()};
+    DSPLIB_CACHE_T LRUCache<TableKey, TableEntry, TableKeyHash> cache{TABLE_CACHE_SIZE};
+    if (cache.exists(key)) {
+        return cache.get(key).table;
+    }
+
+    auto table = std::make_shared<const PolyphaseTable>(polyphase_table(layout, interp, decim, *h));
+    cache.put(key, TableEntry{h, table});
+    return table;
+}
+
+}   // namespace dsplib
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <dsplib/array.h>
+
+#include "resample/polyphase-kernels.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dsplib {
+
+//packed polyphase branches of the multirate filter (see polyphase-kernels.h for the layouts)
+//the tables are shared between the resampler instances, the float copy of the taps is built once
+//(empty if real_t is float)
+struct PolyphaseTable
+{
+    arr_real h;                   ///< packed branches
+    arr_f32 hf;                   ///< packed branches for the float samples
+    std::vector<uint16_t> xoffs;  ///< input offsets of the branches (zeros for the interpolation)
+    int sublen{0};                ///< branch length
+
+    //packed branches at the precision of the sample type `T`
+    template<typename T>
+    [[nodiscard]] const polyphase_tap_t<T>* taps() const noexcept {
+        if constexpr (std::is_same_v<polyphase_tap_t<T>, real_t>) {
+            return h.data();
+        } else {
+            return hf.data();
+        }
+    }
+};
+
+//decimation: interleaved branches h[j * decim + k]
+PolyphaseTable decimator_table(int decim, span_real h);
+
+//interpolation: contiguous branches [interp * sublen], scaled by interp
+//the layout is the same as for the rate conversion with decim = 1
+PolyphaseTable interpolator_table(int interp, span_real h);
+
+//rate conversion: contiguous branches [interp * sublen] in the processing order
+PolyphaseTable converter_table(int interp, int decim, span_real h);
+
+//layout of the packed table (the resampler type)
+//is set explicitly, because interp = decim = 1 is valid for both the decimator and the interpolator
+enum class PolyphaseLayout
+{
+    Decimator,
+    Interpolator,
+    Converter
+};
+
+//table of the layout: decimator (`interp` is ignored), interpolator (`decim` is ignored) or converter
+PolyphaseTable polyphase_table(PolyphaseLayout layout, int interp, int decim, span_real h);
+
+//cached table of the shared filter, the key is (layout, interp, decim, filter address)
+//the cache owns the filter pointer, so the address is not reused while the entry exists
+std::shared_ptr<const PolyphaseTable> shared_polyphase_table(PolyphaseLayout layout, int interp, int decim,
+                                                             const std::shared_ptr<const arr_real>& h);
+
+//cached `design_multirate_fir` with the kaiser window parameter
+std::shared_ptr<const arr_real> shared_multirate_fir_beta(int interp, int decim, int hlen, real_t beta);
+
+}   // namespace dsplib
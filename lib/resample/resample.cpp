@@ -5,6 +5,9 @@
 #include "dsplib/window.h"
 #include "dsplib/utils.h"
 
+#include "resample/polyphase-tables.h"
+#include "internal/lru-cache.h"
+
 #include <numeric>
 #include <cassert>
 
@@ -12,13 +15,17 @@ namespace dsplib {
 
 namespace {
 
-class BypassResampler : public IResampler
+template<typename T>
+class BypassResampler : public BaseResampler<T>
 {
 public:
     explicit BypassResampler() = default;
-    arr_real process(span_real sig) final {
+    base_array<T> process(span_t<T> sig) final {
         return sig;
     }
+    void process(span_t<T> in, mut_span_t<T> out) final {
+        out.assign(in);
+    }
 };
 
 arr_real _multirate_fir(int interp, int decim, int hlen, real_t beta) {
@@ -37,25 +44,92 @@ arr_real _multirate_fir(int interp, int decim, int hlen, real_t beta) {
     return num;
 }
 
+//kaiser window shape parameter for the stopband attenuation (dB)
+real_t _kaiser_beta(real_t astop) {
+    real_t beta = 5.0;
+    if (astop >= 50) {
+        beta = 0.1102 * (astop - 8.71);
+    } else if ((astop < 50) && (astop > 21)) {
+        beta = 0.5842 * std::pow(astop - 21, 0.4) + 0.07886 * (astop - 21);
+    }
+    return beta;
+}
+
+constexpr int FIR_CACHE_SIZE = 16;
+
+struct FirKey
+{
+    int interp;
+    int decim;
+    int hlen;
+    real_t beta;
+
+    bool operator==(const FirKey& rhs) const noexcept {
+        return (interp == rhs.interp) && (decim == rhs.decim) && (hlen == rhs.hlen) && (beta == rhs.beta);
+    }
+};
+
+struct FirKeyHash
+{
+    size_t operator()(const FirKey& k) const noexcept {
+        size_t seed = std::hash<real_t>{}(k.beta);
+        for (int v : {k.interp, k.decim, k.hlen}) {
+            seed ^= size_t(v) + 0x9E3779B9U + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+};
+
 }   // namespace
 
+//------------------------------------------------------------------------------
+std::shared_ptr<const arr_real> shared_multirate_fir_beta(int interp, int decim, int hlen, real_t beta) {
+    const auto [p, q] = IResampler::simplify(interp, decim);
+    const FirKey key{p, q, hlen, beta};
+    DSPLIB_CACHE_T LRUCache<FirKey, std::shared_ptr<const arr_real>, FirKeyHash> cache{FIR_CACHE_SIZE};
+    if (cache.exists(key)) {
+        return cache.get(key);
+    }
+    auto h = std::make_shared<const arr_real>((p == q) ? arr_real{1.0} : _multirate_fir(p, q, hlen, beta));
+    cache.put(key, h);
+    return h;
+}
+
+std::shared_ptr<const arr_real> shared_multirate_fir(int interp, int decim, int hlen, real_t astop) {
+    return shared_multirate_fir_beta(interp, decim, hlen, _kaiser_beta(astop));
+}
+
 //------------------------------------------------------------------------------
 arr_real design_multirate_fir(int interp, int decim, int hlen, real_t astop) {
     auto [p, q] = IResampler::simplify(interp, decim);
     if (p == q) {
         return {1.0};
     }
+    return _multirate_fir(p, q, hlen, _kaiser_beta(astop));
+}
 
-    real_t beta = 5.0;
-    if (astop >= 50) {
-        beta = 0.1102 * (astop - 8.71);
-    } else if ((astop < 50) && (astop > 21)) {
-        beta = 0.5842 * std::pow(astop - 21, 0.4) + 0.07886 * (astop - 21);
+//------------------------------------------------------------------------------
+arr_real design_halfband_fir(int hlen, real_t astop) {
+    DSPLIB_ASSERT(hlen > 0, "filter half-length must be positive");
+    const int m = 2 * hlen - 1;
+    const int n = 2 * m + 1;
+    //the window is wider by the two outer zero taps, so the last non-zero taps are not suppressed
+    const auto win = window::kaiser(n + 2, _kaiser_beta(astop));
+    arr_real h(n);
+    //every second tap is exactly zero
+    for (int k = 1; k <= m; k += 2) {
+        const real_t v = std::sin(pi * k / 2) / (pi * k) * win[m + 1 + k];
+        h[m + k] = v;
+        h[m - k] = v;
     }
-    return _multirate_fir(p, q, hlen, beta);
+    //unit DC gain by the side taps only, so the center tap stays exactly 0.5
+    h *= real_t(0.5) / sum(h);
+    h[m] = 0.5;
+    return h;
 }
 
-std::vector<arr_real> IResampler::polyphase(span_real h, int m, real_t gain, bool flip_coeffs) {
+template<typename T>
+std::vector<arr_real> BaseResampler<T>::polyphase(span_real h, int m, real_t gain, bool flip_coeffs) {
     const int nh = (h.size() % m == 0) ? (h.size()) : ((h.size() / m + 1) * m);
     auto ph = zeropad(h, nh);
     ph /= sum(h);
@@ -79,97 +153,172 @@ std::vector<arr_real> IResampler::polyphase(span_real h, int m, real_t gain, boo
     return r;
 }
 
-std::pair<int, int> IResampler::simplify(int p, int q) {
+template<typename T>
+std::pair<int, int> BaseResampler<T>::simplify(int p, int q) {
     int gcd = std::gcd(p, q);
     p /= gcd;
     q /= gcd;
     return std::make_pair(p, q);
 }
 
-int IResampler::next_size(int size, int p, int q) {
+template<typename T>
+int BaseResampler<T>::next_size(int size, int p, int q) {
     auto [_, d] = simplify(p, q);
     size = (size % d == 0) ? (size) : ((size / d + 1) * d);
     return size;
 }
 
-int IResampler::prev_size(int size, int p, int q) {
+template<typename T>
+int BaseResampler<T>::prev_size(int size, int p, int q) {
     auto [_, d] = simplify(p, q);
     size = (size % d == 0) ? (size) : (size / d * d);
     return size;
 }
 
-//------------------------------------------------------------------------------
-FIRResampler::FIRResampler(int out_fs, int in_fs)
-  : FIRResampler(out_fs, in_fs, design_multirate_fir(out_fs, in_fs)) {
-}
+template class BaseResampler<float>;
+template class BaseResampler<double>;
+template class BaseResampler<cmplx_t>;
 
-FIRResampler::FIRResampler(int out_fs, int in_fs, span_real h) {
-    const auto [m, d] = IResampler::simplify(out_fs, in_fs);
+//------------------------------------------------------------------------------
+namespace {
 
+//h - span_real or shared filter
+template<typename T, typename H>
+std::shared_ptr<BaseResampler<T>> _fir_resampler(int m, int d, const H& h, typename BaseFIRResampler<T>::Mode& mode) {
+    using Mode = typename BaseFIRResampler<T>::Mode;
     if (m == d) {
-        rsmp_ = std::make_shared<BypassResampler>();
-        mode_ = Mode::Bypass;
-        return;
+        mode = Mode::Bypass;
+        return std::make_shared<BypassResampler<T>>();
     }
 
-    if ((d > 1) && (m == 1)) {
-        rsmp_ = std::make_shared<FIRDecimator>(d, h);
-        mode_ = Mode::Decimator;
+    if (m == 1) {
+        mode = Mode::Decimator;
+        return std::make_shared<BaseFIRDecimator<T>>(d, h);
     }
 
-    if ((d == 1) && (m > 1)) {
-        rsmp_ = std::make_shared<FIRInterpolator>(m, h);
-        mode_ = Mode::Interpolator;
+    if (d == 1) {
+        mode = Mode::Interpolator;
+        return std::make_shared<BaseFIRInterpolator<T>>(m, h);
     }
 
-    if ((d > 1) && (m > 1)) {
-        rsmp_ = std::make_shared<FIRRateConverter>(m, d, h);
-        mode_ = Mode::Resampler;
-    }
+    mode = Mode::Resampler;
+    return std::make_shared<BaseFIRRateConverter<T>>(m, d, h);
+}
+
+}   // namespace
+
+template<typename T>
+BaseFIRResampler<T>::BaseFIRResampler(int out_fs, int in_fs)
+  : BaseFIRResampler(out_fs, in_fs, shared_multirate_fir(out_fs, in_fs)) {
 }
 
-int FIRResampler::delay() const noexcept {
+template<typename T>
+BaseFIRResampler<T>::BaseFIRResampler(int out_fs, int in_fs, span_real h) {
+    const auto [m, d] = BaseResampler<T>::simplify(out_fs, in_fs);
+    rsmp_ = _fir_resampler<T>(m, d, h, mode_);
+}
+
+template<typename T>
+BaseFIRResampler<T>::BaseFIRResampler(int out_fs, int in_fs, std::shared_ptr<const arr_real> h) {
+    const auto [m, d] = BaseResampler<T>::simplify(out_fs, in_fs);
+    rsmp_ = _fir_resampler<T>(m, d, h, mode_);
+}
+
+template<typename T>
+int BaseFIRResampler<T>::delay() const noexcept {
     return rsmp_->delay();
 }
 
-int FIRResampler::interp_rate() const noexcept {
+template<typename T>
+int BaseFIRResampler<T>::output_size(int size) const noexcept {
+    return rsmp_->output_size(size);
+}
+
+template<typename T>
+int BaseFIRResampler<T>::interp_rate() const noexcept {
     return rsmp_->interp_rate();
 }
 
-int FIRResampler::decim_rate() const noexcept {
+template<typename T>
+int BaseFIRResampler<T>::decim_rate() const noexcept {
     return rsmp_->decim_rate();
 }
 
-arr_real FIRResampler::process(span_real sig) {
+template<typename T>
+base_array<T> BaseFIRResampler<T>::process(span_t<T> sig) {
     return rsmp_->process(sig);
 }
 
+template<typename T>
+void BaseFIRResampler<T>::process(span_t<T> in, mut_span_t<T> out) {
+    rsmp_->process(in, out);
+}
+
+template class BaseFIRResampler<float>;
+template class BaseFIRResampler<double>;
+template class BaseFIRResampler<cmplx_t>;
+
 //------------------------------------------------------------------------------
-arr_real resample(span_real x, int p_, int q_, int n, real_t beta) {
+namespace {
+
+template<typename T>
+base_array<T> _resample(span_t<T> x, int p, int q, BaseFIRResampler<T>& rsmp) {
+    const int nx = IResampler::next_size(x.size(), p, q);
+    const int ny = nx * p / q;
+    const int dl = rsmp.delay();
+    const int mdl = dl * q / p;
+    const int nn = IResampler::next_size(nx + mdl, p, q);
+    const auto xx = zeropad(x, nn);
+    const auto y = rsmp.process(xx).slice(dl, dl + ny).copy();
+    return y;
+}
+
+template<typename T>
+base_array<T> _resample(span_t<T> x, int p_, int q_, span_real h) {
     const auto [p, q] = IResampler::simplify(p_, q_);
     if (p == q) {
         return x;
     }
 
-    const auto h = _multirate_fir(p, q, n, beta);
-    return resample(x, p, q, h);
+    BaseFIRResampler<T> rsmp(p, q, h);
+    return _resample(x, p, q, rsmp);
 }
 
-arr_real resample(span_real x, int p_, int q_, span_real h) {
+template<typename T>
+base_array<T> _resample(span_t<T> x, int p_, int q_, int n, real_t beta) {
     const auto [p, q] = IResampler::simplify(p_, q_);
     if (p == q) {
         return x;
     }
 
-    FIRResampler rsmp(p, q, h);
-    const int nx = IResampler::next_size(x.size(), p, q);
-    const int ny = nx * p / q;
-    const int dl = rsmp.delay();
-    const int mdl = dl * q / p;
-    const int nn = IResampler::next_size(nx + mdl, p, q);
-    const auto xx = zeropad(x, nn);
-    const auto y = rsmp.process(xx).slice(dl, dl + ny).copy();
-    return y;
+    BaseFIRResampler<T> rsmp(p, q, shared_multirate_fir_beta(p, q, n, beta));
+    return _resample(x, p, q, rsmp);
+}
+
+}   // namespace
+
+arr_f32 resample(span_f32 x, int p, int q, int n, real_t beta) {
+    return _resample(x, p, q, n, beta);
+}
+
+arr_f64 resample(span_f64 x, int p, int q, int n, real_t beta) {
+    return _resample(x, p, q, n, beta);
+}
+
+arr_cmplx resample(span_cmplx x, int p, int q, int n, real_t beta) {
+    return _resample(x, p, q, n, beta);
+}
+
+arr_f32 resample(span_f32 x, int p, int q, span_real h) {
+    return _resample(x, p, q, h);
+}
+
+arr_f64 resample(span_f64 x, int p, int q, span_real h) {
+    return _resample(x, p, q, h);
+}
+
+arr_cmplx resample(span_cmplx x, int p, int q, span_real h) {
+    return _resample(x, p, q, h);
 }
 
-}   // namespace dsplib
\ No newline at end of file
+}   // namespace dsplib
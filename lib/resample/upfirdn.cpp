@@ -0,0 +1,109 @@
+#include "dsplib/resample.h"
+
+#include "resample/polyphase-kernels.h"
+#include "internal/scratch.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace dsplib {
+
+namespace {
+
+//IResampler::polyphase is not used here, it normalizes the taps by sum(h)
+//branches are flipped, padded to the same length and stored in the processing order of the rate converter:
+//hc[k * sublen + (sublen - 1 - j)] = h[(k * q) % p + j * p], see `polyphase_convert`
+void _upfirdn_branches(span_real h, int p, int q, int sublen, mut_span_real hc, mut_span_t<uint16_t> xoffs) {
+    const int nh = h.size();
+    const int interp = xoffs.size();
+    std::fill(hc.begin(), hc.end(), real_t(0));
+    for (int k = 0; k < interp; ++k) {
+        const int ph = int((int64_t(k) * q) % p);
+        for (int j = 0; (ph + j * p) < nh; ++j) {
+            hc[k * sublen + (sublen - 1 - j)] = h[ph + j * p];
+        }
+        xoffs[k] = uint16_t((int64_t(k) * q) / p);
+    }
+}
+
+template<typename T>
+base_array<T> _upfirdn(span_t<T> x, span_real h, int p, int q) {
+    DSPLIB_ASSERT((p > 0) && (q > 0), "upsample and downsample factors must be positive");
+    DSPLIB_ASSERT(!h.empty(), "filter coefficients must not be empty");
+    const int nx = x.size();
+    const int nh = h.size();
+    if (nx == 0) {
+        return {};
+    }
+
+    //the output `i * interp + k` is the branch `k` at the input `i * decim + xoffs[k]`
+    const int g = std::gcd(p, q);
+    const int interp = p / g;
+    const int decim = q / g;
+    const int sublen = (nh + p - 1) / p;
+    const int ny = ((nx - 1) * p + nh + q - 1) / q;
+
+    ScratchScope scratch;
+    auto hc = scratch.alloc<real_t>(interp * sublen);
+    auto xoffs = scratch.alloc<uint16_t>(interp);
+    const bool blocked = (decim <= std::numeric_limits<uint16_t>::max());
+    if (blocked) {
+        _upfirdn_branches(h, p, q, sublen, hc, xoffs);
+    }
+
+    //the blocks with all windows inside the input, the zero-stuffed signal is never formed
+    int i1 = 0;
+    int i2 = 0;
+    if (blocked && (nx > xoffs[interp - 1])) {
+        i1 = (sublen - 1 + decim - 1) / decim;
+        i2 = std::max(i1, std::min((nx - 1 - xoffs[interp - 1]) / decim + 1, ny / interp));
+    }
+
+    base_array<T> y(ny, uninitialized);
+    if (i2 > i1) {
+        const T* px = x.data() + (i1 * decim - (sublen - 1));
+        polyphase_convert(px, hc.data(), xoffs.data(), y.data() + i1 * interp, i2 - i1, interp, decim, sublen);
+    }
+
+    //the edges: the window is clamped to the input range
+    auto hk = scratch.alloc<real_t>(sublen);
+    for (int m = 0; m < ny; ++m) {
+        if (m == i1 * interp) {
+            m = std::max(m, i2 * interp);
+            if (m >= ny) {
+                break;
+            }
+        }
+        const int64_t pos = int64_t(m) * q;
+        const int ix = int(pos / p);   ///< last input sample of the window
+        const int ph = int(pos % p);
+        const int k1 = std::max(0, sublen - 1 - ix);
+        const int k2 = std::min(sublen, nx + sublen - 1 - ix);
+        if (k2 <= k1) {
+            y[m] = 0;
+            continue;
+        }
+
+        //the branch taps in the flipped order (only the window part)
+        const int nk = k2 - k1;
+        for (int k = 0; k < nk; ++k) {
+            const int j = sublen - 1 - (k1 + k);
+            hk[k] = ((ph + j * p) < nh) ? h[ph + j * p] : real_t(0);
+        }
+        polyphase_decimate(x.data() + (ix - sublen + 1 + k1), hk.data(), y.data() + m, 1, 1, nk);
+    }
+    return y;
+}
+
+}   // namespace
+
+arr_real upfirdn(span_real x, span_real h, int p, int q) {
+    return _upfirdn(x, h, p, q);
+}
+
+arr_cmplx upfirdn(span_cmplx x, span_real h, int p, int q) {
+    return _upfirdn(x, h, p, q);
+}
+
+}   // namespace dsplib
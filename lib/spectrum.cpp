@@ -3,9 +3,12 @@
 #include "dsplib/fft.h"
 #include "dsplib/keywords.h"
 #include "dsplib/math.h"
+#include "dsplib/expr.h"
 #include "dsplib/utils.h"
 #include "dsplib/window.h"
 
+#include "internal/scratch.h"
+
 namespace dsplib {
 
 namespace {
@@ -23,13 +26,25 @@ arr_real _calcspec(const base_array<T>& x, const arr_real& win, int noverlap, in
     const auto winpow = (type == SpectrumType::Psd) ? dot(win, win) : abs2(sum(win));
 
     arr_real pxx(nfft);
-    base_array<T> seg(winlen);
+    const auto plan = [&] {
+        if constexpr (is_complex_v<T>) {
+            return fft_plan_c(nfft);
+        } else {
+            return fft_plan_r(nfft);
+        }
+    }();
+
+    //the segment is padded with zeros (or truncated) to nfft
+    const int nseg = std::min(winlen, nfft);
+    ScratchScope scratch;
+    auto seg = scratch.zeros<T>(nfft);
+    auto spec = scratch.alloc<cmplx_t>(nfft);
     for (int i = 0; i < num_segments; ++i) {
         int t1 = (i * stride);
-        int t2 = t1 + winlen;
-        seg.slice(0, winlen) = x.slice(t1, t2);
-        seg *= win;
-        pxx += dsplib::abs2(dsplib::fft(seg, nfft)) / winpow;
+        int t2 = t1 + nseg;
+        seg.slice(0, nseg) = lazy(x.slice(t1, t2)) * lazy(win.slice(0, nseg));
+        plan->solve(seg, spec);
+        pxx += dsplib::abs2(lazy(spec)) / winpow;
     }
     pxx /= num_segments;
     return pxx;
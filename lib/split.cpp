@@ -0,0 +1,77 @@
+#include "dsplib/split.h"
+#include "dsplib/fft.h"
+#include "dsplib/ifft.h"
+
+#include "internal/scratch.h"
+
+namespace dsplib {
+
+arr_cmplx_split::arr_cmplx_split(span_cmplx x)
+  : arr_cmplx_split(x.size(), uninitialized) {
+    deinterleave(x, *this);
+}
+
+arr_cmplx arr_cmplx_split::to_cmplx() const {
+    arr_cmplx r(size(), uninitialized);
+    interleave(*this, r);
+    return r;
+}
+
+//-------------------------------------------------------------------------------------------------
+arr_real abs2(span_cmplx_split x) {
+    arr_real r(x.size(), uninitialized);
+    abs2(x, r);
+    return r;
+}
+
+arr_cmplx_split multiply(span_cmplx_split x1, span_cmplx_split x2, bool conj2) {
+    arr_cmplx_split r(x1.size(), uninitialized);
+    multiply(x1, x2, r, conj2);
+    return r;
+}
+
+//-------------------------------------------------------------------------------------------------
+void fft(span_cmplx_split x, mut_span_cmplx_split r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    const int n = x.size();
+    ScratchScope scratch;
+    auto t1 = scratch.alloc<cmplx_t>(n);
+    auto t2 = scratch.alloc<cmplx_t>(n);
+    interleave(x, t1);
+    fft_plan_c(n)->solve(t1, t2);
+    deinterleave(t2, r);
+}
+
+arr_cmplx_split fft(span_cmplx_split x) {
+    arr_cmplx_split r(x.size(), uninitialized);
+    fft(x, r);
+    return r;
+}
+
+void fft(span_real x, mut_span_cmplx_split r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    const int n = x.size();
+    ScratchScope scratch;
+    auto t = scratch.alloc<cmplx_t>(n);
+    fft_plan_r(n)->solve(x, t);
+    deinterleave(t, r);
+}
+
+void ifft(span_cmplx_split x, mut_span_cmplx_split r) {
+    DSPLIB_ASSERT(x.size() == r.size(), "arrays sizes must be equal");
+    const int n = x.size();
+    ScratchScope scratch;
+    auto t1 = scratch.alloc<cmplx_t>(n);
+    auto t2 = scratch.alloc<cmplx_t>(n);
+    interleave(x, t1);
+    ifft_plan_c(n)->solve(t1, t2);
+    deinterleave(t2, r);
+}
+
+arr_cmplx_split ifft(span_cmplx_split x) {
+    arr_cmplx_split r(x.size(), uninitialized);
+    ifft(x, r);
+    return r;
+}
+
+}   // namespace dsplib
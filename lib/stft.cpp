@@ -2,35 +2,45 @@
 #include <dsplib/window.h>
 #include <dsplib/utils.h>
 #include <dsplib/math.h>
+#include <dsplib/expr.h>
 #include <dsplib/fft.h>
 #include <dsplib/ifft.h>
 
+#include "internal/scratch.h"
+
 namespace dsplib {
 
 namespace {
 
-arr_cmplx _convert_range_stft(const arr_cmplx& x, int nfft, StftRange range) {
+arr_cmplx _convert_range_stft(span_cmplx x, int nfft, StftRange range) {
     DSPLIB_ASSERT(x.size() == nfft, "Input size must be equal `nfft`");
     if (range == StftRange::Onesided) {
         return x.slice(0, nfft / 2 + 1);
     }
     if (range == StftRange::Centered) {
-        return concatenate(x.slice(nfft / 2 + 1, nfft), x.slice(0, nfft / 2 + 1));   //TODO: concat for slices
+        return concatenate(x.slice(nfft / 2 + 1, nfft), x.slice(0, nfft / 2 + 1));
     }
     return x;
 }
 
-arr_cmplx _convert_range_istft(const arr_cmplx& x, int nfft, StftRange range) {
+//convert to the twosided spectrum `r[nfft]`
+void _convert_range_istft(span_cmplx x, int nfft, StftRange range, mut_span_cmplx r) {
     if (range == StftRange::Onesided) {
         DSPLIB_ASSERT(x.size() == nfft / 2 + 1, "Input size must be equal `nfft/2+1` for `onesided` range");
-        return concatenate(x, flip(conj(x.slice(1, nfft / 2))));
+        r.slice(0, nfft / 2 + 1) = x;
+        for (int i = 1; i < nfft / 2; ++i) {
+            r[nfft - i] = conj(x[i]);
+        }
+        return;
     }
     if (range == StftRange::Centered) {
         DSPLIB_ASSERT(x.size() == nfft, "Input size must be equal `nfft` for `centered` range");
-        return concatenate(x.slice(nfft / 2 - 1, nfft), x.slice(0, nfft / 2 - 1));   //TODO: concat for slices
+        r.slice(0, nfft / 2 + 1) = x.slice(nfft / 2 - 1, nfft);
+        r.slice(nfft / 2 + 1, nfft) = x.slice(0, nfft / 2 - 1);
+        return;
     }
     DSPLIB_ASSERT(x.size() == nfft, "Input size must be equal `nfft` for `twosided` range");
-    return x;
+    r.assign(x);
 }
 
 }   // namespace
@@ -68,12 +78,16 @@ std::vector<arr_cmplx> stft(const arr_real& x, const arr_real& win, int overlap,
     const int hop = nwin - overlap;
     const int nseg = (nx - overlap) / (nwin - overlap);
     const auto fftp = fft_plan_r(nfft);
-    arr_real px(nfft);
+    ScratchScope scratch;
+    auto px = scratch.zeros<real_t>(nfft);
+    auto spec = scratch.alloc<cmplx_t>(nfft);
+    y.reserve(nseg);
     for (int i = 0; i < nseg; ++i) {
         const int t1 = (i * hop);
         const int t2 = t1 + nwin;
-        px.slice(0, nwin) = x.slice(t1, t2) * win;
-        y.emplace_back(_convert_range_stft(fftp->solve(px), nfft, range));   //TODO: inplace
+        px.slice(0, nwin) = lazy(x.slice(t1, t2)) * lazy(win);
+        fftp->solve(px, spec);
+        y.emplace_back(_convert_range_stft(spec, nfft, range));
     }
     return y;
 }
@@ -91,19 +105,26 @@ arr_real istft(const std::vector<arr_cmplx>& xx, const arr_real& win, int overla
     const int xlen = nwin + (nseg - 1) * hop;
 
     const int a = method == OverlapMethod::Ola ? 0 : 1;
-    auto norm_val = zeros(xlen);   ///TODO: too big array
-    const auto win_nom = power(win, a);
-    const auto win_den = power(win, a + 1);
+    //the output-length buffer is not taken from the workspace
+    arr_real norm_val = zeros(xlen);   ///TODO: too big array
+    ScratchScope scratch;
+    auto win_nom = scratch.alloc<real_t>(nwin);
+    auto win_den = scratch.alloc<real_t>(nwin);
+    for (int i = 0; i < nwin; ++i) {
+        win_nom[i] = (a == 0) ? real_t(1) : win[i];
+        win_den[i] = win_nom[i] * win[i];
+    }
 
     const auto irfftp = ifft_plan_r(nfft);
+    auto spec = scratch.alloc<cmplx_t>(nfft);
+    auto y = scratch.alloc<real_t>(nfft);
     arr_real x(xlen);
     for (int i = 0; i < nseg; ++i) {
-        //TODO: copy optimmization for `_convert_range`
-        const arr_real y = irfftp->solve(_convert_range_istft(xx[i], nfft, range)).slice(0, nwin);
+        _convert_range_istft(xx[i], nfft, range, spec);
+        irfftp->solve(spec, y);
         const int t1 = i * hop;
         const int t2 = t1 + nwin;
-        //TODO: remove slice unpacking
-        x.slice(t1, t2) += y * win_nom;
+        x.slice(t1, t2) += lazy(y.slice(0, nwin)) * lazy(win_nom);
         norm_val.slice(t1, t2) += win_den;
     }
 
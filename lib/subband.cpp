@@ -4,6 +4,8 @@
 #include "dsplib/fft.h"
 #include "dsplib/ifft.h"
 
+#include "internal/scratch.h"
+
 // original FilterBanks sources: `https://github.com/kkumatani/distant_speech_recognition`
 
 // details: Digital Receivers and Transmitters Using Polyphase Filter Banks for Wireless Communications, 2003
@@ -146,10 +148,9 @@ public:
     CircBuffer gsi_;
 };
 
-arr_real _design_filter(int num_bands, int num_taps) {
-    //TODO: cache last coeffs
+std::shared_ptr<const arr_real> _design_filter(int num_bands, int num_taps) {
     assert(num_taps % 2 == 0);
-    return design_multirate_fir(1, num_bands, num_taps / 2, 80);
+    return shared_multirate_fir(1, num_bands, num_taps / 2, 80);
 }
 
 }   // namespace
@@ -170,7 +171,8 @@ public:
 
         gsi_.push(x);
 
-        arr_real convert(nbands_);
+        ScratchScope scratch;
+        auto convert = scratch.zeros<real_t>(nbands_);
         for (int i = 0; i < decim_; i++) {
             auto gsi = gsi_[decim_ - i - 1];
             for (int k = 0; k < d_; ++k) {
@@ -180,7 +182,7 @@ public:
         buf_.push(convert, true);
 
         // calculate outputs of polyphase filters
-        arr_real pout(nbands_);
+        auto pout = scratch.zeros<real_t>(nbands_);
         for (int k = 0; k < ntaps_; k++) {
             auto buf = buf_[decim_ * k];
             auto flt = fview_[k];
@@ -190,7 +192,8 @@ public:
         }
 
         //TODO: flip and remove conj
-        auto out = fft_->solve(pout);
+        arr_cmplx out(nbands_, uninitialized);
+        fft_->solve(pout, out);
         conj(inplace(out));
         return out;
     }
@@ -216,7 +219,9 @@ public:
     arr_real process(span_cmplx x) {
         DSPLIB_ASSERT(x.size() == nbands_, "input vector size error");
 
-        auto xx = ifft_->solve(x);
+        ScratchScope scratch;
+        auto xx = scratch.alloc<real_t>(nbands_);
+        ifft_->solve(x, xx);
         xx *= nbands_;
 
         //TODO: fft and flip?
@@ -224,7 +229,7 @@ public:
 
         // calculate outputs of polyphase filters
         // TODO: alternative impl for ntaps > nbands
-        arr_real convert(nbands_);
+        auto convert = scratch.zeros<real_t>(nbands_);
         for (int k = 0; k < ntaps_; k++) {
             auto buf = buf_[decim_ * k];
             auto flt = fview_[k];
@@ -1,6 +1,7 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include <dsplib/utils.h>
+#include <dsplib/fixed.h>
 #include <dsplib/math.h>
 #include <dsplib/fft.h>
 #include <dsplib/ifft.h>
@@ -121,14 +122,15 @@ uint32_t _from_bytes(const uint8_t* bytes, endian order) {
     return _from_bytes_32<uint32_t>(bytes, order);
 }
 
-template<typename T>
-arr_real _from_file(const std::string& file, long count, endian order, long offset) {
+//T - file sample type, R - result sample type
+template<typename T, typename R = real_t>
+aligned_vector<R> _from_file(const std::string& file, long count, endian order, long offset) {
     FILE* fid = fopen(file.c_str(), "rb");
     DSPLIB_ASSERT(fid != nullptr, "open file error");
 
     std::array<uint8_t, sizeof(T)> bytes{0};
     fseek(fid, offset, SEEK_CUR);
-    std::vector<real_t> res;
+    aligned_vector<R> res;
     while (!feof(fid) && count) {
         auto rcount = fread(bytes.data(), bytes.size(), 1, fid);
         if (rcount) {
@@ -160,6 +162,10 @@ arr_real from_file(const std::string& file, dtype type, endian order, long offse
     }
 }
 
+arr_q15 from_file_q15(const std::string& file, endian order, long offset, long count) {
+    return _from_file<int16_t, q15_t>(file, count, order, offset);
+}
+
 //-------------------------------------------------------------------------------------------------
 real_t peakloc(span_real x, int idx, bool cyclic) {
     const int n = x.size();
@@ -229,7 +235,7 @@ arr_real linspace(real_t x1, real_t x2, size_t n) {
         return arr_real{x1, x2};
     }
     const real_t step = (x2 - x1) / (n - 1);
-    arr_real out(n);
+    arr_real out(n, uninitialized);
     for (size_t i = 0; i < n; ++i) {
         out[i] = x1 + (i * step);
     }
@@ -245,7 +251,7 @@ base_array<T> _circshift(const base_array<T>& x, int k) {
     if (n == 1 || k == 0) {
         return x;
     }
-    base_array<T> y(n);
+    base_array<T> y(n, uninitialized);
     for (size_t i = 0; i < n; ++i) {
         const size_t p = (i + k + n) % n;
         y[i] = x[p];
@@ -328,8 +334,12 @@ base_array<T> _zeropad(span_t<T> x, int n) {
 
 }   // namespace
 
-arr_real zeropad(span_real x, int n) {
-    return _zeropad<real_t>(x, n);
+arr_f32 zeropad(span_f32 x, int n) {
+    return _zeropad<float>(x, n);
+}
+
+arr_f64 zeropad(span_f64 x, int n) {
+    return _zeropad<double>(x, n);
 }
 
 arr_cmplx zeropad(span_cmplx x, int n) {
@@ -348,7 +358,7 @@ base_array<T> _concatenate(span_t<T> a1, span_t<T> a2, span_t<T> a3, span_t<T> a
         nr += x.size();
     }
 
-    base_array<T> r(nr);
+    base_array<T> r(nr, uninitialized);
     auto* pr = r.data();
     for (const auto& x : span_list) {
         if (x.empty()) {
@@ -362,8 +372,12 @@ base_array<T> _concatenate(span_t<T> a1, span_t<T> a2, span_t<T> a3, span_t<T> a
 
 }   // namespace
 
-arr_real concatenate(span_real x1, span_real x2, span_real x3, span_real x4, span_real x5) {
-    return _concatenate<real_t>(x1, x2, x3, x4, x5);
+arr_f32 concatenate(span_f32 x1, span_f32 x2, span_f32 x3, span_f32 x4, span_f32 x5) {
+    return _concatenate<float>(x1, x2, x3, x4, x5);
+}
+
+arr_f64 concatenate(span_f64 x1, span_f64 x2, span_f64 x3, span_f64 x4, span_f64 x5) {
+    return _concatenate<double>(x1, x2, x3, x4, x5);
 }
 
 arr_cmplx concatenate(span_cmplx x1, span_cmplx x2, span_cmplx x3, span_cmplx x4, span_cmplx x5) {
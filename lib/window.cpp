@@ -14,7 +14,7 @@ namespace {
 
 //not exist in matlab, result compatible with scipy/torch
 arr_real _cosinewin(int n, int m) noexcept {
-    arr_real w(m);
+    arr_real w(m, uninitialized);
     for (int i = 0; i < m; ++i) {
         w[i] = std::sin(pi / n * (i + 0.5));
     }
@@ -22,7 +22,7 @@ arr_real _cosinewin(int n, int m) noexcept {
 }
 
 arr_real _hannwin(int n, int m) noexcept {
-    arr_real w(m);
+    arr_real w(m, uninitialized);
     for (int i = 0; i < m; ++i) {
         w[i] = 0.5 - 0.5 * std::cos((2 * pi * i) / (n - 1));
     }
@@ -30,7 +30,7 @@ arr_real _hannwin(int n, int m) noexcept {
 }
 
 arr_real _hammingwin(int n, int m) noexcept {
-    arr_real w(m);
+    arr_real w(m, uninitialized);
     for (int i = 0; i < m; ++i) {
         w[i] = 0.54 - 0.46 * std::cos((2 * pi * i) / (n - 1));
     }
@@ -38,7 +38,7 @@ arr_real _hammingwin(int n, int m) noexcept {
 }
 
 arr_real _blackmanwin(int n, int m) noexcept {
-    arr_real w(m);
+    arr_real w(m, uninitialized);
     for (int i = 0; i < m; ++i) {
         w[i] = 0.42 - 0.5 * std::cos((2 * pi * i) / (n - 1)) + 0.08 * std::cos((4 * pi * i) / (n - 1));
     }
@@ -46,7 +46,7 @@ arr_real _blackmanwin(int n, int m) noexcept {
 }
 
 arr_real _blackmanharriswin(int n, int m) noexcept {
-    arr_real w(m);
+    arr_real w(m, uninitialized);
     const real_t a0 = 0.35875;
     const real_t a1 = 0.48829;
     const real_t a2 = 0.14128;
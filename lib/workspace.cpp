@@ -0,0 +1,200 @@
+#include "dsplib/workspace.h"
+#include "dsplib/defs.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace dsplib {
+
+namespace {
+
+constexpr size_t MIN_BLOCK_SIZE = 64 * 1024;
+constexpr size_t BLOCK_ALIGN = DSPLIB_ARRAY_ALIGN;
+constexpr size_t LOCAL_MAX_CAPACITY = 8 * 1024 * 1024;
+
+DSPLIB_CACHE_T Workspace* g_current = nullptr;
+
+size_t _align_up(size_t v, size_t align) noexcept {
+    return (v + align - 1) & ~(align - 1);
+}
+
+}   // namespace
+
+Workspace::Workspace(size_t capacity, std::pmr::memory_resource* upstream, size_t max_capacity)
+  : upstream_{upstream}
+  , max_capacity_{std::max(capacity, max_capacity)} {
+    if (capacity > 0) {
+        _add_block(capacity, BLOCK_ALIGN);
+    }
+}
+
+Workspace::~Workspace() {
+    _release_large(0);
+    _release_blocks();
+}
+
+Workspace::Mark Workspace::mark() const noexcept {
+    return {block_, offset_, large_.size()};
+}
+
+void Workspace::rewind(Mark m) noexcept {
+    _release_large(m.nlarge);
+    block_ = m.block;
+    offset_ = m.offset;
+    //full release: merge the blocks, the next calls will not request the memory from upstream
+    if ((block_ == 0) && (offset_ == 0) && (blocks_.size() > 1) && (capacity() <= max_capacity_)) {
+        const size_t total = capacity();
+        _release_blocks();
+        try {
+            _add_block(total, BLOCK_ALIGN);
+        } catch (...) {
+            //will be allocated on demand
+        }
+    }
+}
+
+void Workspace::reset() noexcept {
+    rewind(Mark{});
+}
+
+void Workspace::trim() noexcept {
+    if ((block_ == 0) && (offset_ == 0)) {
+        _release_blocks();
+        return;
+    }
+    //the blocks after the current one are not used
+    const size_t n = std::min(block_ + 1, blocks_.size());
+    for (size_t i = n; i < blocks_.size(); ++i) {
+        upstream_->deallocate(blocks_[i].data, blocks_[i].size, blocks_[i].align);
+    }
+    blocks_.erase(blocks_.begin() + n, blocks_.end());
+}
+
+void Workspace::set_max_capacity(size_t bytes) noexcept {
+    max_capacity_ = bytes;
+    if (capacity() > max_capacity_) {
+        trim();
+    }
+}
+
+size_t Workspace::max_capacity() const noexcept {
+    return max_capacity_;
+}
+
+size_t Workspace::capacity() const noexcept {
+    size_t total = 0;
+    for (const auto& b : blocks_) {
+        total += b.size;
+    }
+    return total;
+}
+
+size_t Workspace::used() const noexcept {
+    size_t total = offset_;
+    for (size_t i = 0; i < block_ && i < blocks_.size(); ++i) {
+        total += blocks_[i].size;
+    }
+    for (const auto& b : large_) {
+        total += b.size;
+    }
+    return total;
+}
+
+size_t Workspace::num_upstream_allocs() const noexcept {
+    return nallocs_;
+}
+
+Workspace& Workspace::local() {
+    DSPLIB_CACHE_T Workspace ws(0, std::pmr::new_delete_resource(), LOCAL_MAX_CAPACITY);
+    return ws;
+}
+
+Workspace& Workspace::current() {
+    return (g_current != nullptr) ? *g_current : local();
+}
+
+void* Workspace::do_allocate(size_t bytes, size_t alignment) {
+    alignment = std::max(alignment, alignof(std::max_align_t));
+    const Mark top = mark();
+    while (block_ < blocks_.size()) {
+        const auto& b = blocks_[block_];
+        //the absolute address is aligned, the block start can have a smaller alignment
+        const auto base = reinterpret_cast<uintptr_t>(b.data);
+        const size_t pos = _align_up(base + offset_, alignment) - base;
+        if (pos + bytes <= b.size) {
+            offset_ = pos + bytes;
+            return b.data + pos;
+        }
+        //the tail of the block is not used until the next release
+        ++block_;
+        offset_ = 0;
+    }
+
+    //the arena is not grown above the limit, the buffer is returned to upstream on rewind
+    const size_t size = _align_up(std::max(bytes, MIN_BLOCK_SIZE), BLOCK_ALIGN);
+    if (capacity() + size > max_capacity_) {
+        block_ = top.block;
+        offset_ = top.offset;
+        return _alloc_large(bytes, alignment);
+    }
+
+    //the block start is aligned to max(alignment, BLOCK_ALIGN)
+    _add_block(size, alignment);
+    block_ = blocks_.size() - 1;
+    offset_ = bytes;
+    return blocks_.back().data;
+}
+
+void Workspace::do_deallocate(void* /*p*/, size_t /*bytes*/, size_t /*alignment*/) {
+    //released in bulk by `rewind`/`reset`
+}
+
+bool Workspace::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+void Workspace::_add_block(size_t size, size_t align) {
+    align = std::max(align, BLOCK_ALIGN);
+    size = _align_up(size, BLOCK_ALIGN);
+    auto* data = static_cast<std::byte*>(upstream_->allocate(size, align));
+    blocks_.push_back({data, size, align});
+    ++nallocs_;
+}
+
+void* Workspace::_alloc_large(size_t bytes, size_t align) {
+    align = std::max(align, BLOCK_ALIGN);
+    large_.reserve(large_.size() + 1);
+    auto* data = static_cast<std::byte*>(upstream_->allocate(bytes, align));
+    large_.push_back({data, bytes, align});
+    ++nallocs_;
+    return data;
+}
+
+void Workspace::_release_blocks() noexcept {
+    for (const auto& b : blocks_) {
+        upstream_->deallocate(b.data, b.size, b.align);
+    }
+    blocks_.clear();
+    block_ = 0;
+    offset_ = 0;
+}
+
+void Workspace::_release_large(size_t n) noexcept {
+    while (large_.size() > n) {
+        const auto& b = large_.back();
+        upstream_->deallocate(b.data, b.size, b.align);
+        large_.pop_back();
+    }
+}
+
+//------------------------------------------------------------------------------------------------
+WorkspaceGuard::WorkspaceGuard(Workspace& ws) noexcept
+  : prev_{g_current} {
+    g_current = &ws;
+}
+
+WorkspaceGuard::~WorkspaceGuard() {
+    g_current = prev_;
+}
+
+}   // namespace dsplib
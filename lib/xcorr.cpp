@@ -1,52 +1,72 @@
-#include <dsplib/xcorr.h>
-#include <dsplib/fft.h>
-#include <dsplib/ifft.h>
-#include <dsplib/math.h>
-#include <dsplib/utils.h>
-
-namespace dsplib {
-
-namespace {
-
-template<typename T>
-arr_cmplx _xcorr(span_t<T> x1, span_t<T> x2) {
-    const int N1 = x1.size();
-    const int N2 = x2.size();
-    const int M = 1L << nextpow2(N1 + N2 - 1);
-
-    base_array<T> y1(M);
-    y1.slice(0, x1.size()).assign(x1);
-
-    base_array<T> y2(M);
-    y2.slice(M - x2.size(), M).assign(x2);
-
-    auto z1 = fft(y1);
-    conj(inplace(z1));
-    auto z2 = fft(y2);
-    z1 *= z2;
-    auto z = ifft(z1);
-    conj(inplace(z));
-
-    z = flip(z.slice(M - N1 - N2 + 1, M));
-    return z;
-}
-
-}   // namespace
-
-arr_cmplx xcorr(span_cmplx x1, span_cmplx x2) {
-    return _xcorr(x1, x2);
-}
-
-arr_real xcorr(span_real x1, span_real x2) {
-    return real(_xcorr(x1, x2));
-}
-
-arr_real xcorr(span_real x) {
-    return real(_xcorr(x, x));
-}
-
-arr_cmplx xcorr(span_cmplx x) {
-    return _xcorr(x, x);
-}
-
-}   // namespace dsplib
+#include <dsplib/xcorr.h>
+#include <dsplib/fft.h>
+#include <dsplib/ifft.h>
+#include <dsplib/math.h>
+#include <dsplib/utils.h>
+
+#include "internal/scratch.h"
+
+namespace dsplib {
+
+namespace {
+
+template<typename T>
+arr_cmplx _xcorr(span_t<T> x1, span_t<T> x2) {
+    const int N1 = x1.size();
+    const int N2 = x2.size();
+    const int M = 1L << nextpow2(N1 + N2 - 1);
+
+    //the signal-sized buffers above `Workspace::max_capacity` are returned to upstream at the end of the call
+    ScratchScope scratch;
+    auto y1 = scratch.zeros<T>(M);
+    auto y2 = scratch.zeros<T>(M);
+    std::copy(x1.begin(), x1.end(), y1.begin());
+    std::copy(x2.begin(), x2.end(), y2.begin() + (M - N2));
+
+    //r2c transform for the real input
+    const auto fftp = fft_plan_c(M);
+    auto z1 = scratch.alloc<cmplx_t>(M);
+    auto z2 = scratch.alloc<cmplx_t>(M);
+    if constexpr (std::is_same_v<T, real_t>) {
+        const auto fftr = fft_plan_r(M);
+        fftr->solve(y1, z1);
+        fftr->solve(y2, z2);
+    } else {
+        fftp->solve(y1, z1);
+        fftp->solve(y2, z2);
+    }
+
+    //conj(ifft(conj(z1) * z2)) = fft(z1 * conj(z2)) / M
+    for (int i = 0; i < M; ++i) {
+        z2[i] = z1[i] * conj(z2[i]);
+    }
+    fftp->solve(z2, z1);
+
+    //flipped tail
+    const int nz = N1 + N2 - 1;
+    arr_cmplx z(nz, uninitialized);
+    for (int i = 0; i < nz; ++i) {
+        z[i] = z1[M - 1 - i] / real_t(M);
+    }
+    return z;
+}
+
+}   // namespace
+
+arr_cmplx xcorr(span_cmplx x1, span_cmplx x2) {
+    return _xcorr(x1, x2);
+}
+
+arr_real xcorr(span_real x1, span_real x2) {
+    return real(_xcorr(x1, x2));
+}
+
+arr_real xcorr(span_real x) {
+    return real(_xcorr(x, x));
+}
+
+arr_cmplx xcorr(span_cmplx x) {
+    return _xcorr(x, x);
+}
+
+}   // namespace dsplib
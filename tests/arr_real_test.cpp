@@ -1,7 +1,56 @@
 #include "tests_common.h"
 
+#include <cstdlib>
+#include <cstring>
+
 using namespace dsplib;
 
+namespace {
+
+//fill pattern of the aligned allocations, to check that the uninitialized arrays are not filled
+constexpr uint8_t ALLOC_PATTERN = 0x7F;
+thread_local bool g_fill_alloc = false;
+
+}   // namespace
+
+//the replaced aligned allocation (used by the array allocator)
+void* operator new(std::size_t size, std::align_val_t align) {
+    const auto al = static_cast<std::size_t>(align);
+    void* raw = std::malloc(size + al + sizeof(void*));
+    if (raw == nullptr) {
+        throw std::bad_alloc();
+    }
+    const auto addr = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + al - 1) & ~std::uintptr_t(al - 1);
+    void* p = reinterpret_cast<void*>(addr);
+    static_cast<void**>(p)[-1] = raw;
+    if (g_fill_alloc) {
+        std::memset(p, ALLOC_PATTERN, size);
+    }
+    return p;
+}
+
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    try {
+        return ::operator new(size, align);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    if (p != nullptr) {
+        std::free(static_cast<void**>(p)[-1]);
+    }
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t align) noexcept {
+    ::operator delete(p, align);
+}
+
+void operator delete(void* p, std::align_val_t align, const std::nothrow_t&) noexcept {
+    ::operator delete(p, align);
+}
+
 //-------------------------------------------------------------------------------------------------
 TEST(ArrRealTest, Init) {
     arr_real a1;
@@ -258,4 +307,94 @@ TEST(ArrRealTest, VecToArr) {
         auto x2 = dsplib::arr_real(x1);
         ASSERT_EQ_ARR_REAL(x2, arr_real{0, -100000, 200000, -300000});
     }
-}
\ No newline at end of file
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(ArrRealTest, Aligned) {
+    auto _is_aligned = [](const void* p) {
+        return (reinterpret_cast<uintptr_t>(p) % DSPLIB_ARRAY_ALIGN) == 0;
+    };
+
+    for (int n : {1, 3, 17, 1024}) {
+        arr_real x1(n);
+        ASSERT_TRUE(_is_aligned(x1.data()));
+        ASSERT_EQ(sum(x1), 0);
+
+        arr_cmplx x2(n, uninitialized);
+        ASSERT_EQ(x2.size(), n);
+        ASSERT_TRUE(_is_aligned(x2.data()));
+
+        //aligned after copy/conversion
+        arr_real x3 = std::vector<real_t>(n, 1.0);
+        ASSERT_TRUE(_is_aligned(x3.data()));
+        ASSERT_EQ(sum(x3), n);
+        arr_cmplx x4 = x3 * 1i;
+        ASSERT_TRUE(_is_aligned(x4.data()));
+        ASSERT_TRUE(_is_aligned(x3.slice(0, n, 2).copy().data()));
+    }
+
+    {
+        //the result of the operations does not depend on the memory state
+        const arr_real x = arange(64);
+        for (int i = 0; i < 4; ++i) {
+            arr_real y(64, uninitialized);
+            y.slice(0, 64) = x;
+            ASSERT_EQ_ARR_REAL(y * 2, x + x);
+        }
+    }
+
+    {
+        const arr_real x = {1, 2, 3};
+        const std::vector<real_t> v = x.to_vec();
+        ASSERT_EQ(v, (std::vector<real_t>{1, 2, 3}));
+
+        //zero-copy move in and access
+        aligned_vector<real_t> av = {1, 2, 3};
+        const auto* p = av.data();
+        const arr_real y(std::move(av));
+        ASSERT_EQ(y.data(), p);
+        ASSERT_EQ(y.vec().data(), p);
+    }
+
+    {
+        //value initialization as std::allocator, the dirty memory is reused
+        for (int i = 0; i < 4; ++i) {
+            aligned_vector<real_t> y1 = uninitialized_vector<real_t>(256);
+            std::fill(y1.begin(), y1.end(), real_t(1));
+        }
+        const aligned_vector<cmplx_t> y2(256);
+        ASSERT_TRUE(std::all_of(y2.begin(), y2.end(), [](cmplx_t v) {
+            return (v.re == 0) && (v.im == 0);
+        }));
+        aligned_vector<real_t> y3;
+        y3.resize(256);
+        ASSERT_TRUE(std::all_of(y3.begin(), y3.end(), [](real_t v) {
+            return v == 0;
+        }));
+        ASSERT_TRUE(_is_aligned(uninitialized_vector<cmplx_t>(17).data()));
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(ArrRealTest, Uninitialized) {
+    auto _is_filled = [](const auto& x) {
+        const auto* p = reinterpret_cast<const uint8_t*>(x.data());
+        return std::all_of(p, p + x.size() * sizeof(x[0]), [](uint8_t v) {
+            return v == ALLOC_PATTERN;
+        });
+    };
+
+    //the memory of the new arrays is filled with the pattern
+    g_fill_alloc = true;
+    arr_cmplx x1(257, uninitialized);
+    arr_real x2(257, uninitialized);
+    const auto x3 = uninitialized_vector<cmplx_t>(257);
+    arr_cmplx x4(257);
+    g_fill_alloc = false;
+
+    //cmplx_t has the zero-filling default constructor, but it is not called for the uninitialized arrays
+    ASSERT_TRUE(_is_filled(x1));
+    ASSERT_TRUE(_is_filled(x2));
+    ASSERT_TRUE(_is_filled(x3));
+    ASSERT_EQ(sum(abs(x4)), 0);
+}
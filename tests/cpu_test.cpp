@@ -0,0 +1,44 @@
+#include "tests_common.h"
+#include <gtest/gtest.h>
+
+using namespace dsplib;
+
+//-------------------------------------------------------------------------------------------------
+TEST(CpuTest, SimdLevels) {
+    const arr_real t = arange(1003) * 0.01;
+    const arr_real x1 = sin(t * 3.0) + 0.1;
+    const arr_real x2 = cos(t * 5.0);
+    const arr_cmplx z1 = expj(t * 3.0) * 0.5;
+    const arr_cmplx z2 = complex(x1, x2);
+    const arr_cmplx_split s1(z1);
+    const arr_cmplx_split s2(z2);
+
+    ASSERT_EQ(simd_level(), detected_simd_level());
+    const SimdStateGuard guard;   //restores the level when an ASSERT fails
+    set_simd_level(SimdLevel::Baseline);
+    ASSERT_EQ(simd_level(), SimdLevel::Baseline);
+    const real_t sum_ref = sum(x1);
+    const real_t dot_ref = dot(x1, x2);
+    const real_t rms_ref = rms(z1);
+    const cmplx_t cdot_ref = dot(z1, z2);
+    const auto mul_ref = multiply(s1, s2, true).to_cmplx();
+
+    //the reductions differ only by the summation order: n * eps of the sum magnitude (|x1 * x2| < 1.1)
+    const real_t tol = x1.size() * eps() * 2;
+    for (int i = 0; i <= int(detected_simd_level()); ++i) {
+        set_simd_level(SimdLevel(i));
+        ASSERT_NEAR(sum(x1), sum_ref, tol);
+        ASSERT_NEAR(dot(x1, x2), dot_ref, tol);
+        ASSERT_NEAR(rms(z1), rms_ref, tol);
+        ASSERT_CMPLX_NEAR(dot(z1, z2), cdot_ref, tol);
+        ASSERT_CMPLX_NEAR(dot(s1, s2), cdot_ref, tol);
+        ASSERT_EQ_ARR_CMPLX(multiply(s1, s2, true).to_cmplx(), mul_ref, 4 * eps());
+        ASSERT_EQ_ARR_CMPLX(arr_cmplx_split(z2).to_cmplx(), z2, 0);
+    }
+
+    if (detected_simd_level() != SimdLevel::AVX512) {
+        ASSERT_ANY_THROW(set_simd_level(SimdLevel::AVX512));
+    }
+    reset_simd_level();
+    ASSERT_EQ(simd_level(), detected_simd_level());
+}
@@ -0,0 +1,92 @@
+#include "tests_common.h"
+#include <gtest/gtest.h>
+
+using namespace dsplib;
+
+//-------------------------------------------------------------------------------------------------
+TEST(ExprTest, Real) {
+    const arr_real x = sin(arange(32) * 0.1);
+    const arr_real y = cos(arange(32) * 0.3) + 2;
+    const real_t tol = 16 * eps();   //a few ulp of the results (|r| < 4), the evaluation order can differ
+
+    arr_real r1 = lazy(x) * lazy(y) + 1.5;
+    ASSERT_EQ_ARR_REAL(r1, x * y + 1.5, tol);
+
+    arr_real r2 = eval((lazy(x) - lazy(y)) / lazy(y) * 2.0 - lazy(x));
+    ASSERT_EQ_ARR_REAL(r2, (x - y) / y * 2.0 - x, tol);
+
+    //mixed operands: expression and array/span
+    arr_real r3 = 3.0 * lazy(x) + y.slice(0, indexing::end);
+    ASSERT_EQ_ARR_REAL(r3, 3.0 * x + y, tol);
+
+    ASSERT_EQ_ARR_REAL(eval(sqrt(lazy(y))), sqrt(y), tol);
+    ASSERT_EQ_ARR_REAL(eval(log10(lazy(y))), log10(y), tol);
+    ASSERT_EQ_ARR_REAL(eval(abs(-lazy(x))), abs(x), tol);
+    ASSERT_NEAR(sum(lazy(x) * lazy(y)), dot(x, y), x.size() * tol);
+}
+
+TEST(ExprTest, Complex) {
+    const arr_real t = arange(32) * 0.2;
+    const arr_cmplx x = complex(cos(t), sin(t) * 0.5);
+    const arr_real w = window::hann(32);
+
+    //real * complex
+    arr_cmplx r1 = lazy(x) * lazy(w);
+    ASSERT_EQ_ARR_CMPLX(r1, x * w);
+
+    arr_cmplx r2 = lazy(x) * conj(lazy(x)) - cmplx_t{1, 2};
+    ASSERT_EQ_ARR_CMPLX(r2, x * conj(x) - cmplx_t{1, 2});
+
+    ASSERT_EQ_ARR_REAL(eval(abs2(lazy(x))), abs2(x));
+    ASSERT_EQ_ARR_REAL(eval(abs(lazy(x))), abs(x));
+    ASSERT_EQ_ARR_REAL(eval(real(lazy(x)) + imag(lazy(x))), real(x) + imag(x));
+    ASSERT_EQ_ARR_CMPLX(eval(expj(lazy(t))), expj(t));
+}
+
+//the element-wise functions keep the operand precision
+static_assert(std::is_same_v<decltype(eval(abs(lazy(std::declval<const arr_f32&>())))), arr_f32>);
+static_assert(std::is_same_v<decltype(eval(abs2(lazy(std::declval<const arr_f32&>())))), arr_f32>);
+static_assert(std::is_same_v<decltype(eval(sqrt(lazy(std::declval<const arr_f32&>())))), arr_f32>);
+static_assert(std::is_same_v<decltype(eval(exp(lazy(std::declval<const arr_f64&>())))), arr_f64>);
+static_assert(std::is_same_v<decltype(eval(sin(lazy(std::declval<const arr_int&>())))), arr_real>);
+
+TEST(ExprTest, Float32) {
+    const arr_f32 x = {-1.5F, 0.25F, 2.0F, -3.0F};
+    const arr_f32 r = eval(sqrt(abs(lazy(x)) + 1.0F));
+    for (int i = 0; i < x.size(); ++i) {
+        ASSERT_EQ(r[i], std::sqrt(std::abs(x[i]) + 1.0F));
+    }
+}
+
+TEST(ExprTest, Assign) {
+    const arr_real x = sin(arange(16) * 0.1);
+    const arr_real y = cos(arange(16) * 0.3);
+
+    //compound assignment
+    arr_real r1 = x;
+    r1 += lazy(x) * lazy(y);
+    ASSERT_EQ_ARR_REAL(r1, x + x * y);
+    r1 *= lazy(y) + 1;
+    ASSERT_EQ_ARR_REAL(r1, (x + x * y) * (y + 1));
+
+    //element-wise aliasing
+    arr_real r2 = x;
+    r2 = lazy(r2) * lazy(r2) - lazy(y);
+    ASSERT_EQ_ARR_REAL(r2, x * x - y);
+
+    //span and strided slice destinations/sources
+    arr_real r3(32);
+    r3.slice(8, 24) = lazy(x) - lazy(y);
+    ASSERT_EQ_ARR_REAL(r3.slice(8, 24), x - y);
+    r3.slice(0, 32, 2) = lazy(x) * 2.0;
+    ASSERT_EQ_ARR_REAL(r3.slice(0, 32, 2), x * 2.0);
+    arr_real r4 = lazy(r3.slice(0, 32, 2)) + lazy(x);
+    ASSERT_EQ_ARR_REAL(r4, x * 3.0);
+
+    //resize on assignment
+    arr_real r5;
+    r5 = lazy(x) + 1;
+    ASSERT_EQ_ARR_REAL(r5, x + 1);
+
+    ASSERT_ANY_THROW({ arr_real r6 = lazy(x) + lazy(r3); });
+}
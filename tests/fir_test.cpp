@@ -331,4 +331,151 @@ TEST(FirTest, MAFilterStress) {
         const auto y2 = ma_flt.process(x);
         ASSERT_EQ_ARR_REAL(y1, y2);
     }
-}
\ No newline at end of file
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(FirTest, MultiChannelInterleaved) {
+    const int nc = 5;
+    const int n = 1000;
+    auto h = randn(31);
+    std::vector<arr_real> x(nc);
+    for (auto& ch : x) {
+        ch = randn(n);
+    }
+
+    arr_real xi(n * nc);
+    for (int i = 0; i < n; ++i) {
+        for (int c = 0; c < nc; ++c) {
+            xi[i * nc + c] = x[c][i];
+        }
+    }
+
+    //process by frames with different sizes
+    MultiChannelFirR flt(h, nc);
+    arr_real yi;
+    yi |= flt(xi.slice(0, 7 * nc));
+    yi |= flt(xi.slice(7 * nc, 300 * nc));
+    yi |= flt(xi.slice(300 * nc, n * nc));
+    ASSERT_EQ(yi.size(), n * nc);
+
+    for (int c = 0; c < nc; ++c) {
+        FirFilterR ref(h);
+        auto y1 = ref(x[c]);
+        arr_real y2 = yi.slice(c, indexing::end, nc);
+        ASSERT_EQ_ARR_REAL(y1, y2);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(FirTest, MultiChannelPlanar) {
+    const int nc = 8;
+    const int n = 500;
+    auto h = complex(randn(17), randn(17));
+    std::vector<arr_cmplx> x(nc);
+    for (auto& ch : x) {
+        ch = complex(randn(n), randn(n));
+    }
+
+    MultiChannelFirC flt(h, nc);
+    auto y = flt(x);
+    ASSERT_EQ(y.size(), nc);
+    for (int c = 0; c < nc; ++c) {
+        FirFilterC ref(h);
+        ASSERT_EQ_ARR_CMPLX(ref(x[c]), y[c]);
+    }
+
+    //inplace
+    MultiChannelFirR flt2(randn(10), 2);
+    auto xi = randn(100);
+    auto y1 = flt2.process(xi);
+    MultiChannelFirR flt3(flt2.coeffs(), 2);
+    flt3.process(inplace(xi));
+    ASSERT_EQ_ARR_REAL(y1, xi);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(FirTest, MixedRealCmplx) {
+    std::mt19937 engine{0};
+    auto hr = local_randn(engine, 40);
+    auto hc = complex(local_randn(engine, 40), local_randn(engine, 40));
+    auto xr = local_randn(engine, 3000);
+    auto xc = complex(local_randn(engine, 3000), local_randn(engine, 3000));
+    //rounding of the 40-tap sums (different accumulation order of the kernels)
+    const real_t tol = hc.size() * eps() * sum(abs(hc)) * max(abs(xc));
+
+    //real input, complex taps
+    {
+        FirFilterRC flt(hc);
+        FirFilterC ref(hc);
+        arr_cmplx y1 = flt(xr.slice(0, 1000));
+        y1 |= flt(xr.slice(1000, 3000));
+        ASSERT_EQ_ARR_CMPLX(y1, ref(complex(xr)), tol);
+    }
+
+    //complex input, real taps
+    {
+        FirFilterCR flt(hr);
+        FirFilterC ref(complex(hr));
+        arr_cmplx y1 = flt(xc.slice(0, 1000));
+        y1 |= flt(xc.slice(1000, 3000));
+        ASSERT_EQ_ARR_CMPLX(y1, ref(xc), tol);
+    }
+
+    //fft-based
+    {
+        FftFilterRC flt1(hc);
+        FirFilterRC flt2(hc);
+        auto y1 = flt1(xr);
+        auto y2 = flt2(xr);
+        const int n = y1.size();
+        ASSERT_NE(n, 0);
+        ASSERT_EQ_ARR_CMPLX(y1, y2.slice(0, n), tol);
+    }
+
+    {
+        FftFilterCR flt1(hr);
+        FirFilterCR flt2(hr);
+        auto y1 = flt1(xc);
+        auto y2 = flt2(xc);
+        const int n = y1.size();
+        ASSERT_NE(n, 0);
+        ASSERT_EQ_ARR_CMPLX(y1, y2.slice(0, n), tol);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(FirTest, Precision) {
+    const arr_real t = arange(2000) * 0.01;
+    const arr_real x = sin(t * 3.0) + cos(t * 17.0) * 0.5;
+    const arr_real h = fir1(31, 0.2);
+
+    const arr_f32 x32(x);
+    const arr_f32 h32(h);
+    const arr_f64 x64(x);
+    const arr_f64 h64(h);
+
+    FirFilter<float> flt32(h32);
+    FirFilter<double> flt64(h64);
+    arr_f32 y32 = flt32(x32.slice(0, 700));
+    y32 |= flt32(x32.slice(700, 2000));
+    const arr_f64 y64 = flt64(x64);
+    ASSERT_EQ(y32.size(), y64.size());
+    for (int i = 0; i < y64.size(); ++i) {
+        ASSERT_NEAR(y32[i], y64[i], 1e-5);
+    }
+
+    //arithmetic keeps the precision
+    const arr_f32 e32 = y32 * 2.0 - x32;
+    const arr_f64 e64 = y64 * 2.0 - x64;
+    ASSERT_NEAR(sum(e32), sum(e64), 1e-2);
+    ASSERT_NEAR(dot(x32, y32), dot(x64, y64), 1e-2);
+
+    //interleaved channels
+    MultiChannelFir<float> mc32(h32, 2);
+    MultiChannelFir<double> mc64(h64, 2);
+    const arr_f32 z32 = mc32.process(x32);
+    const arr_f64 z64 = mc64.process(x64);
+    for (int i = 0; i < z64.size(); ++i) {
+        ASSERT_NEAR(z32[i], z64[i], 1e-5);
+    }
+}
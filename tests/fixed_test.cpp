@@ -0,0 +1,126 @@
+#include "tests_common.h"
+#include <gtest/gtest.h>
+
+using namespace dsplib;
+
+//-------------------------------------------------------------------------------------------------
+TEST(FixedTest, Convert) {
+    ASSERT_EQ(sat_q15(40000), INT16_MAX);
+    ASSERT_EQ(sat_q15(-40000), INT16_MIN);
+    ASSERT_EQ(add_q15(30000, 30000), INT16_MAX);
+    ASSERT_EQ(sub_q15(-30000, 30000), INT16_MIN);
+    ASSERT_EQ(mul_q15(INT16_MIN, INT16_MIN), INT16_MAX);
+    ASSERT_EQ(mul_q15(16384, 16384), 8192);
+    ASSERT_EQ(mul_q31(INT32_MIN, INT32_MIN), INT32_MAX);
+    ASSERT_EQ(add_q31(INT32_MAX, 1), INT32_MAX);
+
+    const arr_real x = {-1.5, -1.0, -0.5, 0.0, 0.25, 0.999, 1.0, 2.0};
+    const arr_q15 q = to_q15(x);
+    ASSERT_EQ(q[0], INT16_MIN);
+    ASSERT_EQ(q[1], INT16_MIN);
+    ASSERT_EQ(q[2], -16384);
+    ASSERT_EQ(q[4], 8192);
+    ASSERT_EQ(q[6], INT16_MAX);
+    ASSERT_EQ(q[7], INT16_MAX);
+
+    const arr_real t = sin(arange(100) * 0.1) * 0.9;
+    ASSERT_EQ_ARR_REAL(from_q15(to_q15(t)), t, 1.0 / (1 << 15));
+    ASSERT_EQ_ARR_REAL(from_q31(to_q31(t)), t, 1e-9);
+
+    //zero-filled arrays, the memory of the previous arrays is reused
+    for (int i = 0; i < 4; ++i) {
+        const arr_q15 z1(300);
+        const arr_q31 z2(300);
+        const arr_cmplx_q15 z3(300);
+        ASSERT_EQ_ARR_REAL(from_q15(z1), zeros(300), 0);
+        ASSERT_EQ_ARR_REAL(from_q31(z2), zeros(300), 0);
+        ASSERT_TRUE(std::all_of(z3.begin(), z3.end(), [](cmplx_q15_t v) {
+            return (v.re == 0) && (v.im == 0);
+        }));
+        const arr_q15 d = to_q15(t);
+        (void)d;
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(FixedTest, Arithmetic) {
+    const arr_real t = arange(256) * 0.05;
+    const arr_real x1 = sin(t) * 0.4;
+    const arr_real x2 = cos(t * 3.0) * 0.4;
+    const auto q1 = to_q15(x1);
+    const auto q2 = to_q15(x2);
+
+    ASSERT_EQ_ARR_REAL(from_q15(add_q15(q1, q2)), x1 + x2, 1e-4);
+    ASSERT_EQ_ARR_REAL(from_q15(sub_q15(q1, q2)), x1 - x2, 1e-4);
+    ASSERT_EQ_ARR_REAL(from_q15(mul_q15(q1, q2)), x1 * x2, 1e-4);
+
+    const real_t d15 = real_t(dot_q15(q1, q2)) / (int64_t(1) << 30);
+    ASSERT_NEAR(d15, dot(x1, x2), 1e-2);
+    const real_t d31 = real_t(dot_q31(to_q31(x1), to_q31(x2))) / (int64_t(1) << 48);
+    ASSERT_NEAR(d31, dot(x1, x2), 1e-6);
+}
+
+//-------------------------------------------------------------------------------------------------
+//the dispatched kernels are exact for all SIMD levels, including the (-2^15)^2 + (-2^15)^2 pair overflow of int32
+TEST(FixedTest, DotExtremes) {
+    const SimdStateGuard guard;   //restores the level when an ASSERT fails
+    for (int n : {1, 2, 15, 16, 33, 257}) {
+        const arr_q15 a(n, std::numeric_limits<q15_t>::min());
+        arr_q15 b(n, std::numeric_limits<q15_t>::min());
+        int64_t ref15 = 0;
+        for (int i = 0; i < n; ++i) {
+            b[i] = (i % 3 == 2) ? std::numeric_limits<q15_t>::max() : b[i];
+            ref15 += int32_t(a[i]) * b[i];
+        }
+        const arr_q31 c(n, std::numeric_limits<q31_t>::min());
+        const int64_t ref31 = n * ((int64_t(c[0]) * c[0]) >> 14);
+        for (int i = 0; i <= int(detected_simd_level()); ++i) {
+            set_simd_level(SimdLevel(i));
+            ASSERT_EQ(dot_q15(a, b), ref15);
+            ASSERT_EQ(dot_q15(a, a), int64_t(n) << 30);
+            ASSERT_EQ(dot_q31(c, c), ref31);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(FixedTest, Fir) {
+    const arr_real t = arange(3000) * 0.01;
+    const arr_real x = (sin(t * 3.0) + cos(t * 41.0)) * 0.45;
+    const arr_real h = fir1(40, 0.1);
+    const arr_real ref = FirFilterR(h).process(x);
+
+    //block processing with the state
+    FirFilterQ15 flt(to_q15(h));
+    const auto qx = to_q15(x);
+    arr_real y = from_q15(flt(make_span(qx).slice(0, 1111)));
+    y |= from_q15(flt(make_span(qx).slice(1111, 3000)));
+    ASSERT_EQ_ARR_REAL(y, ref, 1e-3);
+
+    FirFilterQ31 flt31(to_q31(h));
+    ASSERT_EQ_ARR_REAL(from_q31(flt31(to_q31(x))), ref, 1e-6);
+
+    //decimator = every 4-th output of the filter
+    FirDecimatorQ15 dec(4, to_q15(h));
+    arr_real yd = from_q15(dec(make_span(qx).slice(0, 1000)));
+    yd |= from_q15(dec(make_span(qx).slice(1000, 3000)));
+    ASSERT_EQ(yd.size(), 750);
+    ASSERT_EQ_ARR_REAL(yd, ref.slice(0, 3000, 4), 1e-3);
+
+    //empty impulse response
+    EXPECT_THROW(FirFilterQ15(to_q15(arr_real{})), std::runtime_error);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(FixedTest, Fft) {
+    for (int n : {8, 64, 512}) {
+        const arr_real t = arange(n);
+        const arr_cmplx x = expj(t * 0.3) * 0.6 + complex(cos(t * 1.7) * 0.3);
+        const arr_cmplx ref = fft(x) / n;
+        const arr_cmplx y = from_q15(fft_q15(to_q15(x)));
+        ASSERT_EQ_ARR_CMPLX(y, ref, 2e-3);
+
+        //the second call uses the cached tables
+        ASSERT_EQ_ARR_CMPLX(from_q15(fft_q15(to_q15(x))), y, 0);
+    }
+}
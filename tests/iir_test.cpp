@@ -0,0 +1,216 @@
+#include "tests_common.h"
+
+using namespace dsplib;
+
+namespace {
+
+arr_real _polymul(const arr_real& p1, const arr_real& p2) {
+    arr_real r(p1.size() + p2.size() - 1);
+    for (int i = 0; i < p1.size(); ++i) {
+        for (int k = 0; k < p2.size(); ++k) {
+            r[i + k] += p1[i] * p2[k];
+        }
+    }
+    return r;
+}
+
+//butterworth lowpass, 4th order, wn=0.2 (matlab: [sos, g] = tf2sos(butter(4, 0.2)))
+const arr_real SOS = {1, 2, 1, 1, -1.04859957636261, 0.296140357561670,
+                      1, 2, 1, 1, -1.32091343081943, 0.632738792885276};
+constexpr real_t SOS_GAIN = 0.00482434335771623;
+
+//straightforward filtfilt: long constant prefix instead of the initial conditions
+template<typename T>
+base_array<T> _filtfilt_ref(const arr_real& b, const arr_real& a, const base_array<T>& x) {
+    const int nconst = 2000;
+    const int nfact = 3 * (std::max(a.size(), b.size()) - 1);
+    const int n = x.size();
+    base_array<T> ext(n + 2 * nfact);
+    for (int i = 0; i < nfact; ++i) {
+        ext[i] = real_t(2) * x[0] - x[nfact - i];
+        ext[nfact + n + i] = real_t(2) * x[n - 1] - x[n - 2 - i];
+    }
+    ext.slice(nfact, nfact + n) = x;
+
+    auto pass = [&](const base_array<T>& v) {
+        base_array<T> pad(nconst);
+        pad.slice(0, nconst) = v[0];
+        const auto y = filter(b, a, concatenate(pad, v));
+        return base_array<T>(y.slice(nconst, indexing::end));
+    };
+
+    const auto y = flip(pass(flip(pass(ext))));
+    return y.slice(nfact, nfact + n);
+}
+
+}   // namespace
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, OnePole) {
+    //y[n] = x[n] + 0.5 * y[n-1]
+    auto x = zeros(20);
+    x[0] = 1;
+    auto y = filter(arr_real{1}, arr_real{1, -0.5}, x);
+    for (int i = 0; i < x.size(); ++i) {
+        ASSERT_NEAR(y[i], std::pow(0.5, i), EQ_ABS_ERR);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, FirCase) {
+    //a = 1, equal FirFilter
+    auto h = randn(15);
+    auto x = randn(1000);
+    auto y1 = filter(h, arr_real{1}, x);
+    auto y2 = FirFilterR(h).process(x);
+    ASSERT_EQ_ARR_REAL(y1, y2);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, InitialConditions) {
+    const arr_real b = {0.2, 0.3, 0.1};
+    const arr_real a = {2, -0.5, 0.2, 0.1};
+    auto x = randn(1000);
+    auto y = filter(b, a, x);
+
+    //split processing with final -> initial conditions
+    arr_real zi = zeros(3);
+    auto [y1, zf1] = filter(b, a, x.slice(0, 333), zi);
+    auto [y2, zf2] = filter(b, a, x.slice(333, 1000), zf1);
+    ASSERT_EQ_ARR_REAL(y, y1 | y2);
+
+    //stateful object
+    IirFilterR flt(b, a);
+    arr_real y3 = flt(x.slice(0, 100));
+    y3 |= flt(x.slice(100, 1000));
+    ASSERT_EQ_ARR_REAL(y, y3);
+    ASSERT_EQ_ARR_REAL(flt.state(), zf2);
+    ASSERT_EQ(flt.order(), 3);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, SosEqualTf) {
+    const arr_real sec1 = SOS.slice(0, 6);
+    const arr_real sec2 = SOS.slice(6, 12);
+    const auto b = _polymul(sec1.slice(0, 3), sec2.slice(0, 3)) * SOS_GAIN;
+    const auto a = _polymul(sec1.slice(3, 6), sec2.slice(3, 6));
+
+    auto x = randn(5000);
+    auto y1 = filter(b, a, x);
+
+    //rounding of the transfer function form, amplified by the poles near the unit circle
+    auto xc = complex(x, randn(5000));
+    const real_t tol = 256 * eps() * max(abs(xc));
+
+    SosFilterR flt(SOS, SOS_GAIN);
+    ASSERT_EQ(flt.num_sections(), 2);
+    arr_real y2 = flt(x.slice(0, 1234));
+    y2 |= flt(x.slice(1234, 5000));
+    ASSERT_EQ_ARR_REAL(y1, y2, tol);
+
+    //complex input
+    auto yc = SosFilterC(SOS, SOS_GAIN).process(xc);
+    ASSERT_EQ_ARR_REAL(real(yc), y1, tol);
+    ASSERT_EQ_ARR_REAL(imag(yc), filter(b, a, imag(xc)), tol);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, SosLowpass) {
+    auto tt = arange(8000);
+    auto x1 = sin(2 * pi * 0.02 * tt / 2);
+    auto x2 = sin(2 * pi * 0.8 * tt / 2);
+    auto y1 = SosFilterR(SOS, SOS_GAIN).process(x1);
+    auto y2 = SosFilterR(SOS, SOS_GAIN).process(x2);
+    const arr_real in1 = x1.slice(100, indexing::end);
+    const arr_real out1 = y1.slice(100, indexing::end);
+    const arr_real out2 = y2.slice(100, indexing::end);
+    ASSERT_NEAR(rms(in1), rms(out1), 0.01);
+    ASSERT_LE(rms(out2), 1e-3);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, MultiChannelSos) {
+    const int nc = 6;
+    const int n = 1000;
+    std::vector<arr_real> x(nc);
+    for (auto& ch : x) {
+        ch = randn(n);
+    }
+
+    ASSERT_THROW(MultiChannelSosFilterR(SOS, -1), std::runtime_error);
+
+    //planar
+    MultiChannelSosFilterR flt(SOS, nc, SOS_GAIN);
+    auto y = flt(x);
+    ASSERT_EQ(y.size(), nc);
+    for (int c = 0; c < nc; ++c) {
+        ASSERT_EQ_ARR_REAL(y[c], sosfilt(SOS, x[c]) * SOS_GAIN, 1e-6);
+    }
+
+    //interleaved
+    arr_real xi(n * nc);
+    for (int i = 0; i < n; ++i) {
+        for (int c = 0; c < nc; ++c) {
+            xi[i * nc + c] = x[c][i];
+        }
+    }
+    flt.reset();
+    arr_real yi = flt(xi.slice(0, 10 * nc));
+    yi |= flt(xi.slice(10 * nc, n * nc));
+    for (int c = 0; c < nc; ++c) {
+        arr_real yc = yi.slice(c, indexing::end, nc);
+        ASSERT_EQ_ARR_REAL(yc, y[c]);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, FiltFiltIir) {
+    const arr_real sec1 = SOS.slice(0, 6);
+    const arr_real sec2 = SOS.slice(6, 12);
+    const auto b = _polymul(sec1.slice(0, 3), sec2.slice(0, 3)) * SOS_GAIN;
+    const auto a = _polymul(sec1.slice(3, 6), sec2.slice(3, 6));
+
+    const auto x = randn(3000);
+    const auto xc = complex(randn(3000), randn(3000));
+    const real_t tol = 256 * eps() * max(abs(xc));   //see SosEqualTf
+
+    const auto y = filtfilt(b, a, x);
+    ASSERT_EQ_ARR_REAL(y, _filtfilt_ref(b, a, x), tol);
+
+    auto yc = filtfilt(b, a, xc);
+    ASSERT_EQ_ARR_CMPLX(yc, _filtfilt_ref(b, a, xc), tol);
+
+    auto xi = xc;
+    filtfilt(b, a, inplace(xi));
+    ASSERT_EQ_ARR_CMPLX(xi, yc);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, FiltFiltFir) {
+    const arr_real a = {1};
+    for (int n : {30, 300}) {
+        //short filter is processed directly, long filter by FFT
+        const auto h = fir1(n, 0.1);
+        const auto x = randn(5000);
+        const auto xc = complex(randn(5000), randn(5000));
+        //rounding of the direct and FFT convolutions (two passes)
+        const real_t tol = 4 * nextpow2(2 * h.size()) * eps() * max(abs(xc));
+
+        const auto y = filtfilt(h, a, x);
+        ASSERT_EQ_ARR_REAL(y, _filtfilt_ref(h, a, x), tol);
+
+        auto xi = x;
+        filtfilt(h, a, inplace(xi));
+        ASSERT_EQ_ARR_REAL(xi, y, tol);
+
+        ASSERT_EQ_ARR_CMPLX(filtfilt(h, a, xc), _filtfilt_ref(h, a, xc), tol);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(IirTest, FiltFiltZeroPhase) {
+    const auto h = fir1(300, 0.1);
+    const auto x = sin(2 * pi * 0.01 * arange(5000) / 2);
+    const auto y = filtfilt(h, arr_real{1}, x);
+    ASSERT_EQ_ARR_REAL(x, y, 1e-2);
+}
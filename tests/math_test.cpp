@@ -567,6 +567,129 @@ TEST(MathTest, Log2) {
     ASSERT_EQ_ARR_REAL(y, r);
 }
 
+//-------------------------------------------------------------------------------------------------
+//vectorized array functions against the std scalar functions
+TEST(MathTest, VecFunctions) {
+    const arr_real t = arange(20000);
+    const arr_real xe = (t / 10000 - 1) * 700;
+    const arr_real xl = exp(xe / 7);
+    const arr_real xs = (t / 10000 - 1) * 2000;
+    const arr_real xt = (t / 10000 - 1) * 12;
+
+    auto check = [](const arr_real& y, const arr_real& x, real_t (*fn)(real_t), real_t tol, bool relative) {
+        for (int i = 0; i < x.size(); ++i) {
+            const real_t ref = fn(x[i]);
+            if (std::isinf(ref)) {
+                ASSERT_EQ(y[i], ref) << "x = " << x[i];
+                continue;
+            }
+            const real_t scale = relative ? std::abs(ref) : real_t(1);
+            ASSERT_LE(std::abs(y[i] - ref), tol * scale) << "x = " << x[i];
+        }
+    };
+
+    const SimdStateGuard guard;   //restores the level and the accuracy when an ASSERT fails
+    for (int level = 0; level <= int(detected_simd_level()); ++level) {
+        set_simd_level(SimdLevel(level));
+        for (auto acc : {MathAccuracy::Precise, MathAccuracy::Fast}) {
+            set_math_accuracy(acc);
+            const real_t tol = (acc == MathAccuracy::Precise) ? 4 * eps() : std::max(real_t(1e-8), 4 * eps());
+            check(exp(xe), xe, std::exp, tol, true);
+            check(log(xl), xl, std::log, tol, true);
+            check(log10(xl), xl, std::log10, tol, true);
+            check(sin(xs), xs, std::sin, tol, false);
+            check(cos(xs), xs, std::cos, tol, false);
+            check(tanh(xt), xt, std::tanh, tol, true);
+            check(
+              mag2db(xl), xl,
+              [](real_t v) {
+                  return 20 * std::log10(v);
+              },
+              tol, true);
+            ASSERT_EQ_ARR_CMPLX(expj(xs), complex(cos(xs), sin(xs)), 0);
+        }
+    }
+    set_math_accuracy(MathAccuracy::Precise);
+    reset_simd_level();
+
+    //special values and the large arguments
+    const real_t nan = std::numeric_limits<real_t>::quiet_NaN();
+    const arr_real sv = {0, -1, inf, -inf, nan, 1e6, 800, -800};
+    const arr_real ye = exp(sv);
+    ASSERT_EQ(ye[0], 1);
+    ASSERT_EQ(ye[2], inf);
+    ASSERT_EQ(ye[3], 0);
+    ASSERT_TRUE(std::isnan(ye[4]));
+    ASSERT_EQ(ye[6], inf);
+    ASSERT_EQ(ye[7], 0);
+    const arr_real yl = log(sv);
+    ASSERT_EQ(yl[0], -inf);
+    ASSERT_TRUE(std::isnan(yl[1]));
+    ASSERT_EQ(yl[2], inf);
+    ASSERT_TRUE(std::isnan(yl[4]));
+    const arr_real ys = sin(sv);
+    ASSERT_TRUE(std::isnan(ys[2]));
+    ASSERT_TRUE(std::isnan(ys[4]));
+    ASSERT_EQ(ys[5], std::sin(real_t(1e6)));
+    const arr_real yt = tanh(sv);
+    ASSERT_EQ(yt[2], 1);
+    ASSERT_EQ(yt[3], -1);
+}
+
+//-------------------------------------------------------------------------------------------------
+//fused complex magnitude/phase/dB kernels against the std scalar functions
+TEST(MathTest, MagPhase) {
+    const arr_real t = arange(20000);
+    const arr_cmplx x = complex(cos(t * 0.37), sin(t * 0.37)) * exp((t / 10000 - 1) * 20);
+
+    arr_real mag(x.size());
+    arr_real phase(x.size());
+    arr_real db(x.size());
+    const SimdStateGuard guard;   //restores the level and the accuracy when an ASSERT fails
+    for (int level = 0; level <= int(detected_simd_level()); ++level) {
+        set_simd_level(SimdLevel(level));
+        for (auto acc : {MathAccuracy::Precise, MathAccuracy::Fast}) {
+            set_math_accuracy(acc);
+            const real_t tol = (acc == MathAccuracy::Precise) ? 4 * eps() : std::max(real_t(1e-8), 4 * eps());
+            magphase(x, mag, phase);
+            abs2db(x, db);
+            for (int i = 0; i < x.size(); ++i) {
+                const real_t ref_phase = std::atan2(x[i].im, x[i].re);
+                const real_t ref_db = 10 * std::log10(x[i].re * x[i].re + x[i].im * x[i].im);
+                ASSERT_LE(std::abs(mag[i] - std::hypot(x[i].re, x[i].im)), 2 * eps() * mag[i]);
+                ASSERT_LE(std::abs(phase[i] - ref_phase), tol * std::abs(ref_phase)) << "x = " << x[i];
+                //the rounding of re^2 + im^2 gives the absolute error ~10/ln(10) * eps near 0 dB
+                ASSERT_LE(std::abs(db[i] - ref_db), tol * (std::abs(ref_db) + 10)) << "x = " << x[i];
+            }
+            ASSERT_EQ_ARR_REAL(angle(x), phase, 0);
+            ASSERT_EQ_ARR_REAL(abs(x), mag, 0);
+            ASSERT_EQ_ARR_REAL(abs2db(x), pow2db(abs2(x)), 8 * eps() * 400);
+        }
+    }
+    set_math_accuracy(MathAccuracy::Precise);
+    reset_simd_level();
+
+    //axes, signed zeros and special values
+    const real_t nan = std::numeric_limits<real_t>::quiet_NaN();
+    const arr_cmplx sv = {{0, 0}, {-0.0, 0}, {-0.0, -0.0}, {-1, 0}, {-1, -0.0}, {0, -2}, {inf, inf},
+                          {-inf, 1}, {1, -inf}, {nan, 1}, {3, 4}};
+    arr_real r(sv.size());
+    angle(sv, r);
+    for (int i = 0; i < sv.size(); ++i) {
+        const real_t ref = std::atan2(sv[i].im, sv[i].re);
+        if (std::isnan(ref)) {
+            ASSERT_TRUE(std::isnan(r[i]));
+        } else {
+            ASSERT_NEAR(r[i], ref, 4 * eps()) << "x = " << sv[i];
+            ASSERT_EQ(std::signbit(r[i]), std::signbit(ref)) << "x = " << sv[i];
+        }
+    }
+    abs2db(sv, r);
+    ASSERT_EQ(r[0], -inf);
+    ASSERT_EQ(r[6], inf);
+    ASSERT_NEAR(r[10], 10 * std::log10(real_t(25)), 4 * eps() * 14);
+}
+
 TEST(MathTest, Sqrt) {
     arr_real x = {0, 1, 2, 3, 4, 5};
     arr_real y = dsplib::sqrt(abs2(x));
@@ -586,4 +709,54 @@ TEST(MathTest, Round) {
         arr_cmplx r = {1 + 1i, 2 + 4i, 4 - 1i, 4 - 5i};
         ASSERT_EQ_ARR_CMPLX(round(x), r);
     }
-}
\ No newline at end of file
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(MathTest, Precision) {
+    const arr_real t = arange(1000) * 0.01;
+    const arr_real x = sin(t * 3.0) * 2.0 + 0.5;
+    const arr_f32 x32(x);
+    const arr_f64 x64(x);
+
+    //reductions keep the precision of the input
+    ASSERT_TRUE(bool(std::is_same_v<decltype(mean(x32)), float>));
+    ASSERT_TRUE(bool(std::is_same_v<decltype(rms(x64)), double>));
+    ASSERT_NEAR(mean(x32), mean(x64), 1e-5);
+    ASSERT_NEAR(rms(x32), rms(x64), 1e-5);
+    ASSERT_NEAR(stddev(x32), stddev(x64), 1e-5);
+    ASSERT_NEAR(median(x32), median(x64), 1e-5);
+    ASSERT_NEAR(norm(x32, 1), norm(x64, 1), 1e-2);
+    ASSERT_NEAR(norm(x32, 3), norm(x64, 3), 1e-3);
+    ASSERT_EQ(max(x32), float(max(x64)));
+    ASSERT_EQ(min(x32), float(min(x64)));
+    ASSERT_EQ(argmax(x32), argmax(x64));
+    ASSERT_EQ(argmin(x32), argmin(x64));
+    ASSERT_NEAR(peak2peak(x32), peak2peak(x64), 1e-5);
+    ASSERT_NEAR(mse(x32, abs(x32)), mse(x64, abs(x64)), 1e-5);
+    ASSERT_NEAR(nmse(x32, abs(x32)), nmse(x64, abs(x64)), 1e-5);
+    ASSERT_FALSE(anynan(x32) || anyinf(x64));
+
+    //element-wise functions
+    auto _check = [](const arr_f32& y32, const arr_f64& y64, double tol) {
+        ASSERT_EQ(y32.size(), y64.size());
+        for (int i = 0; i < y64.size(); ++i) {
+            ASSERT_NEAR(y32[i], y64[i], tol * (1 + std::abs(y64[i])));
+        }
+    };
+    _check(abs(x32), abs(x64), 1e-6);
+    _check(exp(x32), exp(x64), 1e-6);
+    _check(log(abs(x32)), log(abs(x64)), 1e-5);
+    _check(log10(abs(x32)), log10(abs(x64)), 1e-5);
+    _check(sin(x32), sin(x64), 1e-6);
+    _check(cos(x32), cos(x64), 1e-6);
+    _check(tanh(x32), tanh(x64), 1e-6);
+    _check(sqrt(abs(x32)), sqrt(abs(x64)), 1e-6);
+    _check(round(x32), round(x64), 0);
+    _check(pow2db(abs(x32)), pow2db(abs(x64)), 1e-5);
+    _check(db2mag(x32), db2mag(x64), 1e-6);
+    _check(deg2rad(x32), deg2rad(x64), 1e-6);
+    arr_f32 y32 = abs(x32) + 0.1;
+    mag2db(inplace(y32));
+    db2mag(inplace(y32));
+    _check(y32, abs(x64) + 0.1, 1e-5);
+}
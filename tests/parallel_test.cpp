@@ -0,0 +1,92 @@
+#include "tests_common.h"
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace dsplib;
+
+//-------------------------------------------------------------------------------------------------
+TEST(ParallelTest, Reductions) {
+#ifndef DSPLIB_PARALLEL
+    GTEST_SKIP() << "DSPLIB_PARALLEL=OFF";
+#endif
+    ASSERT_EQ(num_threads(), 1);
+    const int n = 1000003;
+    const arr_real t = arange(n) * 0.001;
+    const arr_real x1 = sin(t * 3.0) + 0.1;
+    const arr_real x2 = cos(t * 5.0);
+    const arr_cmplx z1 = complex(x1, x2);
+    const arr_cmplx z2 = expj(t);
+
+    //the same block partition for any number of threads
+    const ParallelStateGuard guard;
+    set_parallel_threshold(1000);
+    const real_t sum_ref = sum(x1);
+    const real_t dot_ref = dot(x1, x2);
+    const cmplx_t cdot_ref = dot(z1, z2);
+    const real_t rms_ref = rms(z1);
+    const real_t norm_ref = norm(x1);
+    const real_t mse_ref = mse(z1, z2);
+    const real_t nmse_ref = nmse(x1, x2);
+    const arr_real exp_ref = exp(x2);
+    const arr_real db_ref = abs2db(z1);
+
+    for (int nt : {2, 3, 8}) {
+        set_num_threads(nt);
+        ASSERT_EQ(num_threads(), nt);
+        ASSERT_EQ(sum(x1), sum_ref);
+        ASSERT_EQ(dot(x1, x2), dot_ref);
+        ASSERT_EQ(dot(z1, z2).re, cdot_ref.re);
+        ASSERT_EQ(dot(z1, z2).im, cdot_ref.im);
+        ASSERT_EQ(rms(z1), rms_ref);
+        ASSERT_EQ(norm(x1), norm_ref);
+        ASSERT_EQ(mse(z1, z2), mse_ref);
+        ASSERT_EQ(nmse(x1, x2), nmse_ref);
+        ASSERT_EQ_ARR_REAL(exp(x2), exp_ref, 0);
+        ASSERT_EQ_ARR_REAL(abs2db(z1), db_ref, 0);
+    }
+
+    //the single-block result differs only by rounding
+    set_num_threads(1);
+    set_parallel_threshold(1 << 20);
+    ASSERT_NEAR(sum(x1) / sum_ref, 1, 1e-5);
+    ASSERT_NEAR(dot(x1, x2) / dot_ref, 1, 1e-5);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(ParallelTest, ArgMaxThreads) {
+#ifndef DSPLIB_PARALLEL
+    GTEST_SKIP() << "DSPLIB_PARALLEL=OFF";
+#endif
+    const int n = 500000;
+    arr_real x = zeros(n);
+    x[1000] = 5;
+    x[300000] = 5;
+    x[400000] = -5;
+    x[490000] = -5;
+
+    const ParallelStateGuard guard;
+    set_parallel_threshold(1000);
+    set_num_threads(4);
+    ASSERT_EQ(argmax(x), 1000);
+    ASSERT_EQ(argmin(x), 400000);
+    ASSERT_EQ(max(x), 5);
+    ASSERT_EQ(min(x), -5);
+
+    //the calls from several threads: the busy pool is replaced by the calling thread, the result is the same
+    const arr_real y = sin(arange(n) * 0.01);
+    const real_t ref = sum(y);
+    std::vector<real_t> r(4);
+    std::vector<std::thread> threads;
+    for (int k = 0; k < 4; ++k) {
+        threads.emplace_back([&, k]() {
+            r[k] = sum(y);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (int k = 0; k < 4; ++k) {
+        ASSERT_EQ(r[k], ref);
+    }
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "tests_common.h"
+#include <numeric>
 
 namespace {
 
@@ -221,4 +222,472 @@ TEST(Resampler, ChirpInterpDecim) {
         }
     }
     ASSERT_GE(fstop, 0.95);
-}
\ No newline at end of file
+}
+
+//-------------------------------------------------------------------------------------------------
+namespace {
+
+//reference upfirdn with zero-stuffed signal
+template<typename T>
+dsplib::base_array<T> _upfirdn_ref(const dsplib::base_array<T>& x, const dsplib::arr_real& h, int p, int q) {
+    const int nu = (x.size() - 1) * p + 1;
+    const int ny = (nu + h.size() - 1 + q - 1) / q;
+    dsplib::base_array<T> xu(nu);
+    for (int i = 0; i < x.size(); ++i) {
+        xu[i * p] = x[i];
+    }
+    dsplib::base_array<T> y(ny);
+    for (int m = 0; m < ny; ++m) {
+        for (int k = 0; k < h.size(); ++k) {
+            const int i = m * q - k;
+            if (i >= 0 && i < nu) {
+                y[m] += xu[i] * h[k];
+            }
+        }
+    }
+    return y;
+}
+
+}   // namespace
+
+TEST(Resampler, Upfirdn) {
+    using namespace dsplib;
+    ASSERT_EQ_ARR_REAL(upfirdn(arr_real{1, 2, 3}, arr_real{1, 1}, 2, 1), arr_real{1, 1, 2, 2, 3, 3});
+
+    for (int p : {1, 2, 3, 5, 6}) {
+        for (int q : {1, 2, 4, 7, 9}) {
+            const auto h = randn(31);
+            //the input is shorter than the branch
+            const int nx = (p == 6) ? 4 : 100;
+            const auto x = randn(nx);
+            const auto xc = complex(randn(nx), randn(nx));
+            //rounding of the 31-tap sums
+            const real_t tol = h.size() * eps() * sum(abs(h)) * max(abs(xc));
+            ASSERT_EQ_ARR_REAL(upfirdn(x, h, p, q), _upfirdn_ref(x, h, p, q), tol);
+            ASSERT_EQ_ARR_CMPLX(upfirdn(xc, h, p, q), _upfirdn_ref(xc, h, p, q), tol);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, Complex) {
+    using namespace dsplib;
+    const auto re = randn(4800);
+    const auto im = randn(4800);
+    const auto x = complex(re, im);
+    const real_t tol = 64 * eps() * max(abs(x));   //different accumulation order of the kernels
+
+    //complex resamplers are equal to the processing of the real and imaginary parts
+    auto check = [&](IResampler& rr, IResampler& ri, IResamplerC& rc) {
+        for (int i = 0; i < 2; ++i) {
+            const auto y = rc.process(x);
+            ASSERT_EQ_ARR_CMPLX(y, complex(rr.process(re), ri.process(im)), tol);
+        }
+        ASSERT_EQ(rr.delay(), rc.delay());
+    };
+
+    {
+        FIRDecimator rr(3), ri(3);
+        FIRDecimatorC rc(3);
+        check(rr, ri, rc);
+    }
+    {
+        FIRInterpolator rr(4), ri(4);
+        FIRInterpolatorC rc(4);
+        check(rr, ri, rc);
+    }
+    {
+        FIRRateConverter rr(147, 160), ri(147, 160);
+        FIRRateConverterC rc(147, 160);
+        check(rr, ri, rc);
+    }
+    {
+        FIRResampler rr(32000, 48000), ri(32000, 48000);
+        FIRResamplerC rc(32000, 48000);
+        check(rr, ri, rc);
+    }
+
+    const auto y = resample(x, 2, 3);
+    ASSERT_EQ_ARR_CMPLX(y, complex(resample(re, 2, 3), resample(im, 2, 3)), tol);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, ProcessInto) {
+    using namespace dsplib;
+    const auto x = randn(9600);
+
+    //frames shorter and longer than the filter history
+    auto check = [&](IResampler& r1, IResampler& r2) {
+        const int p = r1.interp_rate();
+        const int q = r1.decim_rate();
+        const auto y1 = r1.process(x);
+        arr_real y2(y1.size());
+        const std::vector<int> frames = {1, 2, 50, 7, 600};
+        int ix = 0;
+        int iy = 0;
+        for (int k = 0; ix < x.size(); ++k) {
+            const int n = std::min(frames[k % frames.size()] * q, x.size() - ix);
+            r2.process(x.slice(ix, ix + n), y2.slice(iy, iy + n / q * p));
+            ix += n;
+            iy += n / q * p;
+        }
+        ASSERT_EQ(ix, x.size());
+        ASSERT_EQ_ARR_REAL(y1, y2);
+    };
+
+    {
+        FIRDecimator r1(3), r2(3);
+        check(r1, r2);
+    }
+    {
+        FIRInterpolator r1(4), r2(4);
+        check(r1, r2);
+    }
+    {
+        FIRRateConverter r1(2, 3), r2(2, 3);
+        check(r1, r2);
+    }
+    {
+        FIRResampler r1(44100, 48000), r2(44100, 48000);
+        check(r1, r2);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, Fractional) {
+    using namespace dsplib;
+    const real_t fs1 = 48000.37;
+    const real_t fs2 = 44100;
+    const auto x = sin(2 * pi * 1000 * arange(48000) / fs1);
+
+    FractionalResampler r1(fs2 / fs1);
+    const auto y1 = r1.process(x);
+    ASSERT_NEAR(y1.size(), x.size() * fs2 / fs1, r1.delay() + 2);
+
+    //frame processing is equal to the one-shot processing
+    FractionalResampler r2(fs2 / fs1);
+    arr_real y2;
+    for (int i = 0; i < x.size(); i += 500) {
+        y2 |= r2(x.slice(i, std::min(i + 500, x.size())));
+    }
+    ASSERT_EQ_ARR_REAL(y1, y2);
+
+    //processing into the caller memory, the odd frame sizes
+    FractionalResampler r4(fs2 / fs1);
+    arr_real y4(y1.size());
+    int ny4 = 0;
+    for (int i = 0; i < x.size(); i += 333) {
+        const auto xi = x.slice(i, std::min(i + 333, x.size()));
+        const int n = r4.output_size(xi.size());
+        r4.process(xi, y4.slice(ny4, ny4 + n));
+        ny4 += n;
+    }
+    ASSERT_EQ(ny4, y1.size());
+    ASSERT_EQ_ARR_REAL(y1, y4);
+
+    //tone frequency and amplitude
+    const int dl = std::ceil(r1.frac_delay());
+    const int n = 8192;
+    _check_equal(x.slice(0, n), y1.slice(dl, dl + n), fs1, fs2);
+
+    //tone samples, y(t) = x(t - delay)
+    const auto t = (arange(n) / fs2) - r1.frac_delay() / fs1;
+    const arr_real ref = sin(2 * pi * 1000 * t);
+    const arr_real y = y1.slice(0, n);
+    ASSERT_EQ_ARR_REAL(ref.slice(100, n), y.slice(100, n), 1e-3);
+
+    //time-varying ratio
+    FractionalResamplerC r3(1.0);
+    const auto xc = complex(x);
+    const int ny1 = r3.process(xc.slice(0, 24000)).size();
+    r3.set_ratio(0.5);
+    ASSERT_EQ(r3.ratio(), 0.5);
+    const int ny2 = r3.process(xc.slice(24000, 48000)).size();
+    ASSERT_NEAR(ny1, 24000, r3.delay() + 2);
+    ASSERT_NEAR(ny2, 12000, 2);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, Multistage) {
+    using namespace dsplib;
+    const auto plan = plan_multistage(48);
+    ASSERT_GT(plan.factors.size(), 1);
+    ASSERT_EQ(plan.factors.size(), plan.hlens.size());
+    ASSERT_EQ(plan.hlens.back(), 12);
+    ASSERT_LT(plan.macs, 2 * 12 * 48 / 2);   //single stage: 2 * hlen * decim
+
+    //highly composite and large factors
+    for (int factor : {720720, 1 << 24, 2147483647}) {
+        const auto p = plan_multistage(factor);
+        ASSERT_LE(p.factors.size(), 6);
+        ASSERT_EQ(std::accumulate(p.factors.begin(), p.factors.end(), 1LL, std::multiplies<>()), factor);
+    }
+
+    const int fs1 = 48000;
+    const int fs2 = 1000;
+    const auto x = awgn(sin(2 * pi * 100 * arange(96000) / fs1), 90);
+
+    //decimation
+    MultistageDecimator decim(48);
+    ASSERT_EQ(decim.decim_rate(), 48);
+    const auto y = decim.process(x);
+    ASSERT_EQ(y.size(), x.size() / 48);
+    const int dl = decim.delay();
+    _check_equal(x.slice(0, 48 * 1000), y.slice(dl, dl + 1000), fs1, fs2);
+
+    //frame processing
+    MultistageDecimator decim2(48);
+    arr_real y2(y.size());
+    for (int i = 0; i < x.size(); i += 480) {
+        decim2.process(x.slice(i, i + 480), y2.slice(i / 48, i / 48 + 10));
+    }
+    ASSERT_EQ_ARR_REAL(y, y2);
+
+    //interpolation
+    MultistageInterpolatorC interp(48);
+    const auto xl = complex(sin(2 * pi * 100 * arange(2000) / fs2));
+    const auto z = interp.process(xl);
+    ASSERT_EQ(z.size(), xl.size() * 48);
+    const int dl2 = interp.delay();
+    const arr_real zz = real(z).slice(dl2 + 4800, dl2 + 4800 + 48000);
+    const arr_real zx = real(xl).slice(100, 1100);
+    ASSERT_GE(sinad(zz), 85);
+    ASSERT_NEAR(thd(zz).harmfreq[0] * fs1, thd(zx).harmfreq[0] * fs2, 1.0);
+    ASSERT_NEAR(rms(zz), rms(zx), 1e-3);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, Halfband) {
+    using namespace dsplib;
+    const auto h = design_halfband_fir(12);
+    ASSERT_EQ(h.size(), 47);
+    ASSERT_EQ(h[23], 0.5);
+    ASSERT_NEAR(sum(h), 1.0, h.size() * eps());
+    for (int k = 1; k < 23; k += 2) {
+        ASSERT_EQ(h[23 - k], h[23 + k]);
+        ASSERT_EQ(h[23 + k + 1], 0);
+    }
+
+    //same result as the generic polyphase filters, by frames
+    const auto x = complex(randn(2400), randn(2400));
+    const std::vector<int> frames = {2, 40, 6, 300, 98};
+    const real_t tol = h.size() * eps() * max(abs(x));   //different summation order
+
+    HalfbandDecimatorC hb_decim(12);
+    FIRDecimatorC fir_decim(2, h);
+    ASSERT_EQ(hb_decim.delay(), fir_decim.delay());
+    arr_cmplx y1;
+    arr_cmplx y2;
+    for (int i = 0, k = 0; i < x.size(); k = (k + 1) % frames.size()) {
+        const int n = std::min(frames[k], x.size() - i);
+        y1 |= hb_decim.process(x.slice(i, i + n));
+        y2 |= fir_decim.process(x.slice(i, i + n));
+        i += n;
+    }
+    ASSERT_EQ_ARR_CMPLX(y1, y2, tol);
+
+    HalfbandInterpolatorC hb_interp(12);
+    FIRInterpolatorC fir_interp(2, h);
+    ASSERT_EQ(hb_interp.delay(), fir_interp.delay());
+    arr_cmplx z1;
+    arr_cmplx z2;
+    for (int i = 0, k = 0; i < x.size(); k = (k + 1) % frames.size()) {
+        const int n = std::min(frames[k], x.size() - i);
+        z1 |= hb_interp.process(x.slice(i, i + n));
+        z2 |= fir_interp.process(x.slice(i, i + n));
+        i += n;
+    }
+    ASSERT_EQ_ARR_CMPLX(z1, z2, tol);
+
+    //real input
+    const auto xr = real(x);
+    ASSERT_EQ_ARR_REAL(HalfbandDecimator(12).process(xr), FIRDecimator(2, h).process(xr), tol);
+    ASSERT_EQ_ARR_REAL(HalfbandInterpolator(12).process(xr), FIRInterpolator(2, h).process(xr), tol);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, Cic) {
+    using namespace dsplib;
+
+    //impulse response of the CIC filter (normalized)
+    auto cic_ir = [](int rate, int order, int ddelay) {
+        const arr_real box = ones(rate * ddelay) / (rate * ddelay);
+        arr_real h = zeros(order * (rate * ddelay - 1) + 1);
+        h[0] = 1;
+        for (int k = 0; k < order; ++k) {
+            h = filter(box, arr_real{1}, h);
+        }
+        return h;
+    };
+
+    for (auto [rate, order, ddelay] : {std::tuple{16, 4, 1}, std::tuple{5, 3, 2}, std::tuple{1024, 5, 1}}) {
+        const auto h = cic_ir(rate, order, ddelay);
+        const auto x = complex(rand({-1, 1}, rate * 50), rand({-1, 1}, rate * 50));
+
+        //decimation, y[i] = conv(x, h)[i * rate + rate - 1]
+        //the error is limited by the input quantization and the rounding of the reference filter (|x| < 1.5)
+        CICDecimatorC decim(rate, order, ddelay);
+        const real_t tol = std::max(2 * h.size() * eps(), std::ldexp(real_t(1), -decim.frac_bits()));
+        const auto y = decim.process(x);
+        const auto yf = filter(h, arr_real{1}, x);
+        ASSERT_EQ(y.size(), x.size() / rate);
+        ASSERT_EQ_ARR_CMPLX(y, yf.slice(rate - 1, indexing::end, rate), tol);
+
+        //frame processing
+        CICDecimator decim2(rate, order, ddelay);
+        arr_real y2 = decim2.process(real(x).slice(0, rate * 10));
+        y2 |= decim2.process(real(x).slice(rate * 10, indexing::end));
+        ASSERT_EQ_ARR_REAL(y2, real(y), tol);
+
+        //interpolation, zero insertion and the same filter with the gain `rate`
+        const auto xl = x.slice(0, 50);
+        CICInterpolatorC interp(rate, order, ddelay);
+        const auto z = interp.process(xl);
+        arr_cmplx xz(xl.size() * rate);
+        xz.slice(0, indexing::end, rate) = xl;
+        ASSERT_EQ_ARR_CMPLX(z, filter(h * rate, arr_real{1}, xz), tol);
+    }
+
+    //compensated passband is flat
+    const int rate = 64;
+    const auto hc = design_cic_compensator(rate, 4, 1, 32, 0.5);
+    const auto hf = abs(fft(hc, 1024));
+    for (int k = 0; k < 200; ++k) {
+        const real_t f = real_t(k) / 1024;
+        const real_t g = std::pow(std::sin(pi * f) / (rate * std::sin(pi * f / rate)), 4);
+        const real_t resp = (k == 0) ? hf[0] : hf[k] * g;
+        ASSERT_NEAR(mag2db(resp), 0, 0.1);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, Streaming) {
+    using namespace dsplib;
+    const auto t = arange(3000);
+    const auto x = complex(sin(2 * pi * 0.01 * t) + sin(2 * pi * 0.37 * t), cos(2 * pi * 0.13 * t));
+    const std::vector<int> frames = {1, 7, 0, 13, 250, 3, 64};
+
+    std::vector<std::pair<std::shared_ptr<IResamplerC>, std::shared_ptr<IResamplerC>>> cases = {
+      {std::make_shared<FIRDecimatorC>(5), std::make_shared<FIRDecimatorC>(5)},
+      {std::make_shared<FIRRateConverterC>(3, 7), std::make_shared<FIRRateConverterC>(3, 7)},
+      {std::make_shared<FIRResamplerC>(16000, 44100), std::make_shared<FIRResamplerC>(16000, 44100)},
+      {std::make_shared<HalfbandDecimatorC>(), std::make_shared<HalfbandDecimatorC>()},
+    };
+
+    for (auto& [rsmp, ref] : cases) {
+        const int nx = x.size() / ref->decim_rate() * ref->decim_rate();
+        const auto y1 = ref->process(x.slice(0, nx));
+        arr_cmplx y2;
+        for (int i = 0, k = 0; i < nx; k = (k + 1) % frames.size()) {
+            const int n = std::min(frames[k], nx - i);
+            const int ny = rsmp->output_size(n);
+            arr_cmplx y(ny);
+            rsmp->process(span_cmplx(x.data() + i, n), make_span(y));
+            y2 |= y;
+            i += n;
+        }
+        ASSERT_EQ_ARR_CMPLX(y1, y2);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, SharedFilter) {
+    using namespace dsplib;
+    const auto h1 = shared_multirate_fir(3, 7);
+    const auto h2 = shared_multirate_fir(6, 14);
+    ASSERT_EQ(h1.get(), h2.get());
+    ASSERT_EQ_ARR_REAL(*h1, design_multirate_fir(3, 7));
+
+    //the shared filter gives the same result as the copied one
+    const auto t = arange(700);
+    const auto x = sin(2 * pi * 0.01 * t) + sin(2 * pi * 0.2 * t);
+    FIRRateConverter rsmp1(3, 7, h1);
+    FIRRateConverter rsmp2(3, 7, h2);
+    FIRRateConverter rsmp3(3, 7, *h1);
+    const auto y = rsmp3.process(x);
+    ASSERT_EQ_ARR_REAL(rsmp1.process(x), y);
+    ASSERT_EQ_ARR_REAL(rsmp2.process(x), y);
+    ASSERT_EQ_ARR_REAL(FIRDecimator(7).process(x), FIRDecimator(7, design_multirate_fir(1, 7)).process(x));
+    ASSERT_EQ_ARR_REAL(FIRInterpolator(3).process(x), FIRInterpolator(3, design_multirate_fir(3, 1)).process(x));
+
+    //interp = decim = 1: the decimator and the interpolator tables are not shared (asymmetric taps)
+    const auto h3 = std::make_shared<const arr_real>(arr_real{1, 2, 3, 4});
+    ASSERT_EQ_ARR_REAL(FIRDecimator(1, h3).process(x), FIRDecimator(1, *h3).process(x));
+    ASSERT_EQ_ARR_REAL(FIRInterpolator(1, h3).process(x), FIRInterpolator(1, *h3).process(x));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, MultiChannel) {
+    using namespace dsplib;
+    const int nc = 5;
+    const int n = 1470;
+    std::vector<arr_cmplx> x(nc);
+    for (int c = 0; c < nc; ++c) {
+        const auto t = arange(n);
+        x[c] = complex(sin(2 * pi * 0.01 * (c + 1) * t), cos(2 * pi * 0.03 * (c + 1) * t));
+    }
+    const real_t tol = 64 * eps();   //|x| < 1.5, different accumulation order of the kernels
+
+    for (auto [out_fs, in_fs] : {std::pair{16000, 48000}, std::pair{48000, 16000}, std::pair{44100, 48000}}) {
+        //planar, equal to the single channel resampler
+        MultiChannelResamplerC rsmp(out_fs, in_fs, nc);
+        const auto y = rsmp(x);
+        ASSERT_EQ(y.size(), nc);
+        for (int c = 0; c < nc; ++c) {
+            FIRResamplerC ref(out_fs, in_fs);
+            ASSERT_EQ(rsmp.delay(), ref.delay());
+            const int nx = ref.prev_size(n);
+            const auto yc = ref.process(x[c].slice(0, nx));
+            ASSERT_EQ_ARR_CMPLX(y[c].slice(0, yc.size()), yc, tol);
+        }
+
+        //interleaved, arbitrary number of frames
+        arr_cmplx xi(n * nc);
+        for (int i = 0; i < n; ++i) {
+            for (int c = 0; c < nc; ++c) {
+                xi[i * nc + c] = x[c][i];
+            }
+        }
+        MultiChannelResamplerC rsmp2(out_fs, in_fs, nc);
+        arr_cmplx yi;
+        for (int i = 0, k = 1; i < n; i += k, k = k * 3 % 17) {
+            const int m = std::min(k, n - i);
+            yi |= rsmp2(xi.slice(i * nc, (i + m) * nc));
+        }
+        for (int c = 0; c < nc; ++c) {
+            arr_cmplx yc = yi.slice(c, indexing::end, nc);
+            ASSERT_EQ_ARR_CMPLX(yc, y[c], tol);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(Resampler, Precision) {
+    using namespace dsplib;
+    const arr_real t = arange(4800) * 0.01;
+    const arr_real x = sin(t * 3.0) * 0.5 + cos(t * 0.7) * 0.25;
+    const arr_f32 x32(x);
+    const arr_f64 x64(x);
+    auto _check = [](const arr_f32& y32, const arr_f64& y64, double tol) {
+        ASSERT_EQ(y32.size(), y64.size());
+        for (int i = 0; i < y64.size(); ++i) {
+            ASSERT_NEAR(y32[i], y64[i], tol);
+        }
+    };
+
+    //the float kernels use the float taps, the kernels are dispatched by the SIMD level
+    const SimdStateGuard guard;   //restores the level when an ASSERT fails
+    for (int level = 0; level <= int(detected_simd_level()); ++level) {
+        set_simd_level(SimdLevel(level));
+        _check(resample(x32, 3, 2), resample(x64, 3, 2), 1e-5);
+        _check(BaseFIRDecimator<float>(4).process(x32), BaseFIRDecimator<double>(4).process(x64), 1e-5);
+        _check(BaseFIRInterpolator<float>(3).process(x32), BaseFIRInterpolator<double>(3).process(x64), 1e-5);
+        _check(BaseHalfbandDecimator<float>().process(x32), BaseHalfbandDecimator<double>().process(x64), 1e-5);
+        _check(BaseMultistageDecimator<float>(8).process(x32), BaseMultistageDecimator<double>(8).process(x64), 1e-5);
+        _check(BaseCICDecimator<float>(4).process(x32), BaseCICDecimator<double>(4).process(x64), 1e-5);
+        _check(BaseFractionalResampler<float>(0.75).process(x32), BaseFractionalResampler<double>(0.75).process(x64),
+               1e-5);
+        _check(BaseMultiChannelResampler<float>(2, 3, 2).process(x32),
+               BaseMultiChannelResampler<double>(2, 3, 2).process(x64), 1e-5);
+    }
+}
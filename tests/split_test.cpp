@@ -0,0 +1,68 @@
+#include "tests_common.h"
+#include <gtest/gtest.h>
+
+using namespace dsplib;
+
+//-------------------------------------------------------------------------------------------------
+TEST(SplitTest, Convert) {
+    const arr_real t = arange(37) * 0.1;
+    const arr_cmplx x = complex(cos(t), sin(t * 2));
+
+    const arr_cmplx_split xs(x);
+    ASSERT_EQ(xs.size(), x.size());
+    ASSERT_EQ_ARR_REAL(xs.re(), real(x));
+    ASSERT_EQ_ARR_REAL(xs.im(), imag(x));
+    ASSERT_EQ_ARR_CMPLX(xs.to_cmplx(), x);
+    ASSERT_CMPLX_EQ(xs[5], x[5]);
+
+    //zero-copy views
+    arr_cmplx_split ys(x.size());
+    auto view = ys.slice(10, 20);
+    deinterleave(x.slice(0, 10), view);
+    ASSERT_EQ(view.re().data(), ys.re().data() + 10);
+    ASSERT_EQ_ARR_CMPLX(ys.to_cmplx().slice(10, 20), x.slice(0, 10));
+    view.set(0, {1, -1});
+    ASSERT_CMPLX_EQ(ys[10], cmplx_t{1, -1});
+
+    arr_cmplx r(10);
+    interleave(xs.slice(5, 15), r);
+    ASSERT_EQ_ARR_CMPLX(r, x.slice(5, 15));
+}
+
+TEST(SplitTest, Kernels) {
+    const arr_real t = arange(67) * 0.1;
+    const arr_cmplx x1 = complex(cos(t), sin(t * 2));
+    const arr_cmplx x2 = complex(sin(t * 3) + 0.5, cos(t));
+    const arr_cmplx_split s1(x1);
+    const arr_cmplx_split s2(x2);
+
+    //|x1 * x2| < 3, the reductions differ by the summation order
+    const real_t tol = 4 * eps();
+    ASSERT_CMPLX_NEAR(dot(s1, s2), dot(x1, x2), x1.size() * tol);
+    ASSERT_EQ_ARR_REAL(abs2(s1), abs2(x1), tol);
+    ASSERT_EQ_ARR_CMPLX(multiply(s1, s2).to_cmplx(), x1 * x2, tol);
+    ASSERT_EQ_ARR_CMPLX(multiply(s1, s2, true).to_cmplx(), x1 * conj(x2), tol);
+
+    //inplace
+    arr_cmplx_split s3 = s1;
+    multiply(s3, s2, s3);
+    ASSERT_EQ_ARR_CMPLX(s3.to_cmplx(), x1 * x2, tol);
+}
+
+TEST(SplitTest, Fft) {
+    for (int n : {16, 100, 512}) {
+        const arr_real t = arange(n) * 0.1;
+        const arr_cmplx x = complex(cos(t), sin(t * 2));
+        const arr_cmplx_split xs(x);
+        const real_t tol = 4 * n * eps();   //|X| <= n
+
+        const auto X = fft(xs);
+        ASSERT_EQ_ARR_CMPLX(X.to_cmplx(), fft(x), tol);
+        ASSERT_EQ_ARR_CMPLX(ifft(X).to_cmplx(), x, tol);
+
+        const arr_real xr = sin(t * 3);
+        arr_cmplx_split Xr(n);
+        fft(xr, Xr);
+        ASSERT_EQ_ARR_CMPLX(Xr.to_cmplx(), fft(xr), tol);
+    }
+}
@@ -3,6 +3,8 @@
 #include <dsplib.h>
 #include <gtest/gtest.h>
 
+#include <random>
+
 constexpr dsplib::real_t EQ_ABS_ERR = 1e-7;
 
 using namespace std::complex_literals;
@@ -57,6 +59,41 @@ void ASSERT_EQ_ARR_CMPLX(const T1& r1, const T2& r2, dsplib::real_t max_err = EQ
 
 namespace dsplib {
 
+//restores the SIMD level and the math accuracy on the scope exit (also when an ASSERT returns)
+class SimdStateGuard
+{
+public:
+    SimdStateGuard() = default;
+    SimdStateGuard(const SimdStateGuard&) = delete;
+    SimdStateGuard& operator=(const SimdStateGuard&) = delete;
+
+    ~SimdStateGuard() {
+        set_math_accuracy(accuracy_);
+        reset_simd_level();
+    }
+
+private:
+    const MathAccuracy accuracy_{math_accuracy()};
+};
+
+//restores the number of threads and the parallel threshold on the scope exit (also when an ASSERT returns)
+class ParallelStateGuard
+{
+public:
+    ParallelStateGuard() = default;
+    ParallelStateGuard(const ParallelStateGuard&) = delete;
+    ParallelStateGuard& operator=(const ParallelStateGuard&) = delete;
+
+    ~ParallelStateGuard() {
+        set_num_threads(num_threads_);
+        set_parallel_threshold(threshold_);
+    }
+
+private:
+    const int num_threads_{num_threads()};
+    const int threshold_{parallel_threshold()};
+};
+
 struct Harm
 {
     real_t freq{0};
@@ -85,4 +122,14 @@ static arr_real chirp(int n, real_t f0, real_t f1, real_t fs) {
     return cos(pi * f * t);
 }
 
+//normally distributed random numbers from the local engine (the global `rng` state is not changed)
+static arr_real local_randn(std::mt19937& engine, int n) {
+    std::normal_distribution<real_t> dist(0, 1);
+    arr_real r(n);
+    for (int i = 0; i < n; ++i) {
+        r[i] = dist(engine);
+    }
+    return r;
+}
+
 }   // namespace dsplib
\ No newline at end of file
@@ -62,6 +62,8 @@ TEST(Template, SupportTypeArray) {
     ASSERT_TRUE(support_type_for_array<real_t>());
     ASSERT_TRUE(support_type_for_array<cmplx_t>());
     ASSERT_TRUE(support_type_for_array<int>());
+    ASSERT_TRUE(support_type_for_array<float>());
+    ASSERT_TRUE(support_type_for_array<double>());
     ASSERT_FALSE(support_type_for_array<std::complex<float>>());
     ASSERT_FALSE(support_type_for_array<std::complex<double>>());
 }
@@ -79,4 +81,13 @@ TEST(Template, ResultType) {
     ASSERT_TRUE(bool(std::is_same_v<ResultType<cmplx_t, int>, cmplx_t>));
     ASSERT_TRUE(bool(std::is_same_v<ResultType<cmplx_t, double>, cmplx_t>));
     ASSERT_TRUE(bool(std::is_same_v<ResultType<float, std::complex<float>>, cmplx_t>));
+
+    //precision of the arrays
+    ASSERT_TRUE(bool(std::is_same_v<ResultType<arr_f32, arr_f32>, float>));
+    ASSERT_TRUE(bool(std::is_same_v<ResultType<arr_f64, arr_f64>, double>));
+    ASSERT_TRUE(bool(std::is_same_v<ResultType<arr_f32, arr_f64>, real_t>));
+    ASSERT_TRUE(bool(std::is_same_v<ResultType<arr_f32, double>, float>));
+    ASSERT_TRUE(bool(std::is_same_v<ResultType<int, arr_f32>, float>));
+    ASSERT_TRUE(bool(std::is_same_v<ResultType<span_f64, float>, double>));
+    ASSERT_TRUE(bool(std::is_same_v<ResultType<arr_f32, cmplx_t>, cmplx_t>));
 }
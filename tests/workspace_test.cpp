@@ -0,0 +1,135 @@
+#include "tests_common.h"
+#include <gtest/gtest.h>
+
+using namespace dsplib;
+
+//-------------------------------------------------------------------------------------------------
+TEST(WorkspaceTest, Arena) {
+    Workspace ws(4096);
+    ASSERT_EQ(ws.capacity(), 4096);
+    ASSERT_EQ(ws.num_upstream_allocs(), 1);
+
+    {
+        std::pmr::vector<real_t> v(&ws);
+        v.reserve(100);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(v.data()) % alignof(real_t), 0);
+        ASSERT_GE(ws.used(), 100 * sizeof(real_t));
+    }
+
+    const auto m = ws.mark();
+    auto* p1 = ws.allocate(1000, 64);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(p1) % 64, 0);
+    ws.rewind(m);
+    auto* p2 = ws.allocate(1000, 64);
+    ASSERT_EQ(p1, p2);
+    ASSERT_EQ(ws.num_upstream_allocs(), 1);
+
+    //grow and merge the blocks on the full release
+    (void)ws.allocate(100000, 64);
+    ASSERT_EQ(ws.num_upstream_allocs(), 2);
+    const auto cap = ws.capacity();
+    ws.reset();
+    ASSERT_EQ(ws.used(), 0);
+    ASSERT_EQ(ws.capacity(), cap);
+    ASSERT_EQ(ws.num_upstream_allocs(), 3);
+    (void)ws.allocate(100000, 64);
+    (void)ws.allocate(1000, 64);
+    ws.reset();
+    ASSERT_EQ(ws.num_upstream_allocs(), 3);
+
+    //alignment is larger than the block alignment (DSPLIB_ARRAY_ALIGN)
+    for (size_t align : {size_t(2 * DSPLIB_ARRAY_ALIGN), size_t(4096)}) {
+        (void)ws.allocate(8, 8);
+        auto* p3 = ws.allocate(100, align);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(p3) % align, 0);
+        auto* p4 = ws.allocate(200000, align);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(p4) % align, 0);
+        ws.reset();
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(WorkspaceTest, SteadyState) {
+    const arr_real t = arange(4096) * 0.01;
+    const arr_real x = sin(t * 3.0) + cos(t * 7.0) * 0.5;
+    const arr_real y = cos(t * 3.0) + sin(t * 11.0) * 0.25;
+    const arr_real x1 = x.slice(0, 1024);
+    const arr_real y1 = y.slice(0, 1024);
+
+    auto pipeline = [&]() {
+        auto pxx = welch(x, 256);
+        auto spec = stft(x, 256);
+        auto xi = istft(spec, 256);
+        auto corr = xcorr(x1, y1);
+        auto gcc = gccphat(x1, y1);
+        return pxx.pxx.size() + xi.size() + corr.size() + gcc.corr.size();
+    };
+
+    auto& ws = Workspace::local();
+    pipeline();
+    ASSERT_EQ(ws.used(), 0);
+
+    const auto nws = ws.num_upstream_allocs();
+    const auto na1 = num_array_allocs();
+    pipeline();
+    const auto na2 = num_array_allocs();
+    pipeline();
+    const auto na3 = num_array_allocs();
+
+    //temporaries are taken from the workspace, the arrays are allocated only for the results
+    ASSERT_EQ(ws.num_upstream_allocs(), nws);
+    ASSERT_EQ(ws.used(), 0);
+    ASSERT_EQ(na2 - na1, na3 - na2);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(WorkspaceTest, Guard) {
+    const arr_real x = sin(arange(2048) * 0.05);
+    const auto pxx_ref = welch(x, 512).pxx;
+
+    Workspace ws;
+    {
+        WorkspaceGuard guard(ws);
+        ASSERT_EQ(&Workspace::current(), &ws);
+        const auto pxx = welch(x, 512).pxx;
+        ASSERT_EQ_ARR_REAL(pxx, pxx_ref);
+    }
+    ASSERT_EQ(&Workspace::current(), &Workspace::local());
+    ASSERT_GT(ws.num_upstream_allocs(), 0);
+    ASSERT_EQ(ws.used(), 0);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST(WorkspaceTest, Limit) {
+    Workspace ws(0, std::pmr::new_delete_resource(), 256 * 1024);
+    ASSERT_EQ(ws.max_capacity(), 256 * 1024);
+
+    //the large buffers are not kept in the arena
+    const auto m = ws.mark();
+    (void)ws.allocate(1000, 64);
+    ASSERT_EQ(ws.capacity(), 64 * 1024);
+    auto* p1 = ws.allocate(1 << 20, 64);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(p1) % 64, 0);
+    ASSERT_GE(ws.used(), 1 << 20);
+    ASSERT_EQ(ws.capacity(), 64 * 1024);
+    (void)ws.allocate(1000, 64);
+    ASSERT_EQ(ws.capacity(), 64 * 1024);
+    ASSERT_EQ(ws.num_upstream_allocs(), 2);
+    ws.rewind(m);
+    ASSERT_EQ(ws.used(), 0);
+
+    //release the memory
+    (void)ws.allocate(100000, 64);
+    ASSERT_EQ(ws.capacity(), 64 * 1024 + 100032);
+    ws.reset();
+    ws.trim();
+    ASSERT_EQ(ws.capacity(), 0);
+    ws.set_max_capacity(0);
+    (void)ws.allocate(1000, 64);
+    ASSERT_EQ(ws.capacity(), 0);
+    ws.reset();
+    ASSERT_EQ(ws.used(), 0);
+
+    //the thread workspace is limited
+    ASSERT_LT(Workspace::local().max_capacity(), std::numeric_limits<size_t>::max());
+}